@@ -0,0 +1,83 @@
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "button_dispatcher.hpp"
+#include "led_frame_buffer.hpp"
+#include "led_switch.hpp"
+
+using namespace std;
+
+// Usage: click_latency_benchmark [producer_threads] [presses_per_thread] [buttons] [pause_us]
+// - every button switches one LED of a frame buffer, the frame is flushed after every dispatched batch
+// - reports click-to-light latency percentiles (press until its batch is flushed)
+
+namespace
+{
+    class NullLEDFrameSink : public ILEDFrameSink
+    {
+    public:
+        size_t written = 0;
+
+        void write(const LEDRange& range) override
+        {
+            written += range.size();
+        }
+    };
+}
+
+int main(int argc, char* argv[])
+{
+    const unsigned threads_count = argc > 1 ? stoul(argv[1]) : 4;
+    const int presses = argc > 2 ? stoi(argv[2]) : 100'000;
+    const int buttons_count = argc > 3 ? stoi(argv[3]) : 1000;
+    const int pause_us = argc > 4 ? stoi(argv[4]) : 0;
+
+    LEDFrameBuffer frame{static_cast<size_t>(buttons_count)};
+    NullLEDFrameSink sink;
+    vector<unique_ptr<FrameBufferLEDLight>> lights;
+    vector<shared_ptr<ISwitch>> switches;
+    for (int i = 0; i < buttons_count; ++i)
+    {
+        lights.push_back(make_unique<FrameBufferLEDLight>(frame, i));
+        switches.push_back(make_shared<LEDSwitch>(*lights.back()));
+    }
+
+    ButtonDispatcher dispatcher{switches, {.after_batch = [&] { frame.flush(sink); }}};
+
+    const auto start = chrono::steady_clock::now();
+    {
+        vector<jthread> threads;
+        for (unsigned t = 0; t < threads_count; ++t)
+        {
+            threads.emplace_back([&, t] {
+                mt19937 rnd{t};
+                uniform_int_distribution<uint32_t> button{0, static_cast<uint32_t>(buttons_count - 1)};
+
+                for (int i = 0; i < presses; ++i)
+                {
+                    dispatcher.press(button(rnd));
+                    if (pause_us > 0)
+                        this_thread::sleep_for(chrono::microseconds{pause_us});
+                }
+            });
+        }
+    }
+    dispatcher.wait_until_dispatched();
+    const chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+    const LatencyHistogram& latency = dispatcher.latency();
+    const auto us = [](chrono::nanoseconds value) { return value.count() / 1000.0; };
+
+    cout << "threads: " << threads_count << "  presses: " << latency.count() << "  buttons: " << buttons_count << "\n";
+    cout << "presses/s: " << latency.count() / elapsed.count() << "  coalesced: " << dispatcher.coalesced_count()
+         << "  LEDs written: " << sink.written << "\n";
+    cout << "click-to-light latency [us]  p50: " << us(latency.percentile(0.5)) << "  p90: " << us(latency.percentile(0.9))
+         << "  p99: " << us(latency.percentile(0.99)) << "  p99.9: " << us(latency.percentile(0.999)) << "  max: " << us(latency.max()) << "\n";
+
+    return 0;
+}
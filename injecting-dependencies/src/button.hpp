@@ -3,6 +3,7 @@
 
 #include <iostream>
 #include <memory>
+#include <string>
 #include "led_light.hpp"
 
 class ISwitch
@@ -13,35 +14,48 @@ public:
     virtual ~ISwitch() = default;
 };
 
-auto btn_number = [] {};
+inline auto btn_number = [] {};
+
+// on/off state of a button's switch - shared by all buttons and ButtonDispatcher
+class SwitchState
+{
+    bool is_on_ {false};
+
+public:
+    template <typename SwitchType>
+    void toggle(SwitchType& light_switch)
+    {
+        if (!is_on_)
+            light_switch.on();
+        else
+            light_switch.off();
+
+        is_on_ = !is_on_;
+    }
+
+    bool is_on() const
+    {
+        return is_on_;
+    }
+};
 
 class Button
 {
     int btn_number_;
     std::shared_ptr<ISwitch> light_switch_;
-    bool is_on_;
+    SwitchState state_;
 
 public:
     Button(int btn_number, std::shared_ptr<ISwitch> light_switch)
         : btn_number_ {btn_number}
         , light_switch_ {light_switch}
-        , is_on_ {false}
     {
     }
 
     void click()
     {
         std::cout << "Button " << btn_number_ << " clicked...\n";
-        if (!is_on_)
-        {
-            light_switch_->on();
-            is_on_ = true;
-        }
-        else
-        {
-            light_switch_->off();
-            is_on_ = false;
-        }
+        state_.toggle(*light_switch_);
     }
 };
 
@@ -54,29 +68,19 @@ namespace HighPerfDI
     {
         int btn_number_;
         SwitchType& light_switch_;
-        bool is_on_;
+        SwitchState state_;
 
     public:
         Button(int btn_number, SwitchType& light_switch)
             : btn_number_ {btn_number}
             , light_switch_ {light_switch}
-            , is_on_ {false}
         {
         }
 
         void click()
         {
             std::cout << "Button " << btn_number_ << " clicked...\n";
-            if (!is_on_)
-            {
-                light_switch_.on();
-                is_on_ = true;
-            }
-            else
-            {
-                light_switch_.off();
-                is_on_ = false;
-            }
+            state_.toggle(light_switch_);
         }
     };
 }
@@ -90,6 +94,9 @@ namespace FactoryMethod
         virtual ~ILogger() = default;
     };
 
+    // logged for every click - also by ButtonDispatcher
+    inline const std::string click_message = "clicked";
+
     class Logger : public ILogger
     {
     public:
@@ -108,7 +115,7 @@ namespace FactoryMethod
     class Button
     {
         int btn_number_;
-        bool is_on_;
+        SwitchState state_;
     protected:
         virtual std::shared_ptr<ISwitch> get_light_switch();        
 
@@ -117,7 +124,7 @@ namespace FactoryMethod
             return Logger::instance();
         }
     public:
-        Button(int btn_number) : btn_number_{}, is_on_{false}
+        Button(int btn_number) : btn_number_{}
         {}
 
         void click()
@@ -125,18 +132,9 @@ namespace FactoryMethod
             auto light_switch = get_light_switch();
 
             std::cout << "Button " << btn_number_ << " clicked...\n";
-            if (!is_on_)
-            {
-                light_switch->on();
-                is_on_ = true;
-            }
-            else
-            {
-                light_switch->off();
-                is_on_ = false;
-            }
-
-            get_logger().log("clicked");    
+            state_.toggle(*light_switch);
+
+            get_logger().log(click_message);
         }
     };
 
@@ -0,0 +1,204 @@
+#ifndef BUTTON_DISPATCHER_HPP
+#define BUTTON_DISPATCHER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "button.hpp"
+#include "latency_histogram.hpp"
+#include "mpsc_queue.hpp"
+
+struct ButtonEvent
+{
+    uint32_t button = 0;
+    std::chrono::steady_clock::time_point pressed_at;
+};
+
+// event-driven alternative to Button::click
+// - press only puts an event on a lock-free queue, any thread can press
+// - dispatcher thread drains events in batches; toggles of the same button within a batch are coalesced,
+//   so a button pressed twice in one batch does not touch its switch at all
+// - switch state is kept and toggled as by Button; every press is logged as by FactoryMethod::Button,
+//   coalesced ones included, when a logger is given
+// - latency from press to the end of its batch (switch calls, logging and after_batch done) is recorded
+class ButtonDispatcher
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Options
+    {
+        size_t queue_capacity = 4096;
+        size_t max_batch_size = 256;
+        std::function<void()> after_batch{}; // called from dispatcher thread, e.g. to flush LEDFrameBuffer
+        FactoryMethod::ILogger* logger = nullptr; // called from dispatcher thread
+    };
+
+    // i-th switch belongs to button i
+    explicit ButtonDispatcher(std::vector<std::shared_ptr<ISwitch>> switches)
+        : ButtonDispatcher(std::move(switches), Options{})
+    {
+    }
+
+    ButtonDispatcher(std::vector<std::shared_ptr<ISwitch>> switches, Options options)
+        : switches_{std::move(switches)}
+        , states_(switches_.size())
+        , toggles_(switches_.size(), 0)
+        , options_{std::move(options)}
+        , queue_{options_.queue_capacity}
+    {
+        if (options_.max_batch_size == 0)
+            throw std::invalid_argument("batch size must be positive");
+
+        batch_.resize(options_.max_batch_size);
+        dispatcher_ = std::jthread([this](std::stop_token stop_token) { dispatch(stop_token); });
+    }
+
+    ButtonDispatcher(const ButtonDispatcher&) = delete;
+    ButtonDispatcher& operator=(const ButtonDispatcher&) = delete;
+
+    // events pressed before destruction are dispatched
+    ~ButtonDispatcher()
+    {
+        dispatcher_.request_stop();
+        wake_dispatcher();
+        dispatcher_.join();
+    }
+
+    // returns false if the queue is full
+    bool try_press(uint32_t button)
+    {
+        if (button >= switches_.size())
+            throw std::out_of_range("unknown button " + std::to_string(button));
+
+        if (!queue_.try_push(ButtonEvent{button, Clock::now()}))
+            return false;
+
+        wake_dispatcher();
+
+        return true;
+    }
+
+    // waits while the queue is full
+    void press(uint32_t button)
+    {
+        while (!try_press(button))
+            std::this_thread::yield();
+    }
+
+    // blocks until all events pressed so far are dispatched
+    // - waits for every claimed queue cell, so presses of other threads still being pushed are waited for as well
+    void wait_until_dispatched() const
+    {
+        const uint64_t pressed = queue_.pushed_count();
+
+        for (uint64_t dispatched = dispatched_.load(std::memory_order_acquire); dispatched < pressed;
+             dispatched = dispatched_.load(std::memory_order_acquire))
+        {
+            dispatched_.wait(dispatched, std::memory_order_acquire);
+        }
+    }
+
+    const LatencyHistogram& latency() const
+    {
+        return latency_;
+    }
+
+    // number of switch calls saved by coalescing
+    uint64_t coalesced_count() const
+    {
+        return coalesced_.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::vector<std::shared_ptr<ISwitch>> switches_;
+    std::vector<SwitchState> states_;
+    std::vector<uint32_t> toggles_;
+    std::vector<ButtonEvent> batch_;
+    Options options_;
+    MpscQueue<ButtonEvent> queue_;
+    LatencyHistogram latency_;
+
+    mutable std::atomic<uint64_t> dispatched_{0};
+    std::atomic<uint64_t> coalesced_{0};
+    std::atomic<uint32_t> wake_ups_{0};
+    std::jthread dispatcher_;
+
+    void wake_dispatcher()
+    {
+        wake_ups_.fetch_add(1, std::memory_order_release);
+        wake_ups_.notify_one();
+    }
+
+    void dispatch(std::stop_token stop_token)
+    {
+        while (true)
+        {
+            const uint32_t wake_ups = wake_ups_.load(std::memory_order_acquire);
+
+            if (dispatch_batch() == 0)
+            {
+                if (stop_token.stop_requested())
+                    return;
+
+                wake_ups_.wait(wake_ups, std::memory_order_acquire);
+            }
+        }
+    }
+
+    // returns number of dispatched events
+    size_t dispatch_batch()
+    {
+        size_t size = 0;
+        while (size < batch_.size() && queue_.try_pop(batch_[size]))
+            ++size;
+
+        if (size == 0)
+            return 0;
+
+        for (size_t i = 0; i < size; ++i)
+            ++toggles_[batch_[i].button];
+
+        uint64_t switch_calls = 0;
+        for (size_t i = 0; i < size; ++i)
+        {
+            const uint32_t button = batch_[i].button;
+
+            if (toggles_[button] % 2 == 1)
+            {
+                states_[button].toggle(*switches_[button]);
+                ++switch_calls;
+            }
+
+            toggles_[button] = 0;
+        }
+
+        if (options_.logger)
+        {
+            for (size_t i = 0; i < size; ++i)
+                options_.logger->log(FactoryMethod::click_message);
+        }
+
+        if (options_.after_batch)
+            options_.after_batch();
+
+        const Clock::time_point dispatched_at = Clock::now();
+        for (size_t i = 0; i < size; ++i)
+            latency_.record(dispatched_at - batch_[i].pressed_at);
+
+        coalesced_.fetch_add(size - switch_calls, std::memory_order_relaxed);
+        dispatched_.fetch_add(size, std::memory_order_release);
+        dispatched_.notify_all();
+
+        return size;
+    }
+};
+
+#endif //BUTTON_DISPATCHER_HPP
@@ -0,0 +1,86 @@
+#ifndef LATENCY_HISTOGRAM_HPP
+#define LATENCY_HISTOGRAM_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+
+// log-linear histogram of latencies in nanoseconds - 16 buckets per power of two (error below 6.25%)
+// - record is wait-free and meant for one writer, percentiles can be read concurrently
+class LatencyHistogram
+{
+    static constexpr unsigned sub_bucket_bits = 4;
+    static constexpr uint64_t sub_buckets = uint64_t{1} << sub_bucket_bits;
+    static constexpr size_t buckets_count = (64 - sub_bucket_bits + 1) * sub_buckets;
+
+    std::array<std::atomic<uint64_t>, buckets_count> buckets_{};
+    std::atomic<uint64_t> count_{0};
+    std::atomic<uint64_t> max_{0};
+
+public:
+    void record(std::chrono::nanoseconds latency)
+    {
+        const auto value = static_cast<uint64_t>(std::max<int64_t>(latency.count(), 0));
+
+        buckets_[bucket_of(value)].fetch_add(1, std::memory_order_relaxed);
+        count_.fetch_add(1, std::memory_order_relaxed);
+        if (value > max_.load(std::memory_order_relaxed))
+            max_.store(value, std::memory_order_relaxed);
+    }
+
+    uint64_t count() const
+    {
+        return count_.load(std::memory_order_relaxed);
+    }
+
+    std::chrono::nanoseconds max() const
+    {
+        return std::chrono::nanoseconds{max_.load(std::memory_order_relaxed)};
+    }
+
+    // upper bound of the bucket holding the given fraction (0.0 - 1.0) of samples
+    std::chrono::nanoseconds percentile(double fraction) const
+    {
+        const uint64_t total = count();
+        if (total == 0)
+            return std::chrono::nanoseconds::zero();
+
+        const auto rank = static_cast<uint64_t>(fraction * static_cast<double>(total - 1)) + 1;
+        uint64_t seen = 0;
+
+        for (size_t bucket = 0; bucket < buckets_count; ++bucket)
+        {
+            seen += buckets_[bucket].load(std::memory_order_relaxed);
+            if (seen >= rank)
+                return std::chrono::nanoseconds{std::min(bucket_upper_bound(bucket), max_.load(std::memory_order_relaxed))};
+        }
+
+        return max();
+    }
+
+private:
+    static size_t bucket_of(uint64_t value)
+    {
+        if (value < sub_buckets)
+            return value;
+
+        const unsigned shift = std::bit_width(value) - 1 - sub_bucket_bits;
+        return (shift + 1) * sub_buckets + ((value >> shift) & (sub_buckets - 1));
+    }
+
+    static uint64_t bucket_upper_bound(size_t bucket)
+    {
+        if (bucket < sub_buckets)
+            return bucket;
+
+        const unsigned shift = bucket / sub_buckets - 1;
+        const uint64_t lower_bound = (sub_buckets + bucket % sub_buckets) << shift;
+
+        return lower_bound + ((uint64_t{1} << shift) - 1);
+    }
+};
+
+#endif //LATENCY_HISTOGRAM_HPP
@@ -0,0 +1,205 @@
+#ifndef LED_FRAME_BUFFER_HPP
+#define LED_FRAME_BUFFER_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <iostream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "led_light.hpp"
+
+// consecutive LEDs changed since the last flush
+struct LEDRange
+{
+    size_t first_led;
+    std::span<const uint8_t> reds;
+    std::span<const uint8_t> greens;
+    std::span<const uint8_t> blues;
+
+    size_t size() const
+    {
+        return reds.size();
+    }
+};
+
+class ILEDFrameSink
+{
+public:
+    virtual void write(const LEDRange& range) = 0;
+    virtual ~ILEDFrameSink() = default;
+};
+
+// prints one line per range instead of one line per LED
+class ConsoleLEDFrameSink : public ILEDFrameSink
+{
+    std::ostream& out_;
+
+public:
+    ConsoleLEDFrameSink(std::ostream& out = std::cout) : out_{out}
+    {}
+
+    void write(const LEDRange& range) override
+    {
+        out_ << "Setting(ids: " << range.first_led << "-" << range.first_led + range.size() - 1 << ";";
+        for (size_t i = 0; i < range.size(); ++i)
+            out_ << " (" << +range.reds[i] << ", " << +range.greens[i] << ", " << +range.blues[i] << ")";
+        out_ << ")\n";
+    }
+};
+
+// colors of all LEDs of a frame as structure of arrays, with one dirty bit per LED
+// - writing the color a LED already has does not mark it dirty
+// - flush passes runs of dirty LEDs to a sink and clears the dirty bits
+class LEDFrameBuffer
+{
+    std::vector<uint8_t> reds_;
+    std::vector<uint8_t> greens_;
+    std::vector<uint8_t> blues_;
+    std::vector<uint64_t> dirty_;
+
+public:
+    struct RGB
+    {
+        uint8_t r, g, b;
+
+        bool operator==(const RGB&) const = default;
+    };
+
+    explicit LEDFrameBuffer(size_t leds_count)
+        : reds_(leds_count), greens_(leds_count), blues_(leds_count), dirty_((leds_count + 63) / 64)
+    {
+    }
+
+    size_t size() const
+    {
+        return reds_.size();
+    }
+
+    // components are clamped to 0-255, throws out_of_range for unknown LED
+    void set_rgb(size_t led, int r, int g, int b)
+    {
+        if (led >= size())
+            throw std::out_of_range("unknown LED " + std::to_string(led));
+
+        set(led, to_component(r), to_component(g), to_component(b));
+    }
+
+    // sets count LEDs starting at first_led to the same color
+    void fill(size_t first_led, size_t count, int r, int g, int b)
+    {
+        if (first_led > size() || count > size() - first_led)
+            throw std::out_of_range("LED range out of frame");
+
+        const uint8_t red = to_component(r);
+        const uint8_t green = to_component(g);
+        const uint8_t blue = to_component(b);
+
+        for (size_t led = first_led; led < first_led + count; ++led)
+            set(led, red, green, blue);
+    }
+
+    RGB rgb(size_t led) const
+    {
+        return {reds_.at(led), greens_.at(led), blues_.at(led)};
+    }
+
+    bool is_dirty() const
+    {
+        return std::any_of(dirty_.begin(), dirty_.end(), [](uint64_t word) { return word != 0; });
+    }
+
+    // returns number of LEDs written to the sink
+    size_t flush(ILEDFrameSink& sink)
+    {
+        size_t written = 0;
+        size_t word_index = 0;
+
+        while (word_index < dirty_.size())
+        {
+            if (dirty_[word_index] == 0)
+            {
+                ++word_index;
+                continue;
+            }
+
+            const size_t first_led = word_index * 64 + std::countr_zero(dirty_[word_index]);
+            const size_t end_led = end_of_dirty_run(first_led);
+            const size_t count = end_led - first_led;
+
+            sink.write(LEDRange{
+                first_led,
+                std::span<const uint8_t>{reds_}.subspan(first_led, count),
+                std::span<const uint8_t>{greens_}.subspan(first_led, count),
+                std::span<const uint8_t>{blues_}.subspan(first_led, count)});
+            written += count;
+
+            clear_dirty(first_led, end_led);
+            word_index = first_led / 64;
+        }
+
+        return written;
+    }
+
+private:
+    static uint8_t to_component(int value)
+    {
+        return static_cast<uint8_t>(std::clamp(value, 0, 255));
+    }
+
+    void set(size_t led, uint8_t r, uint8_t g, uint8_t b)
+    {
+        const bool is_changed = (reds_[led] != r) | (greens_[led] != g) | (blues_[led] != b);
+
+        reds_[led] = r;
+        greens_[led] = g;
+        blues_[led] = b;
+        dirty_[led / 64] |= uint64_t{is_changed} << (led % 64);
+    }
+
+    size_t end_of_dirty_run(size_t first_led) const
+    {
+        size_t led = first_led;
+
+        while (led < size())
+        {
+            const uint64_t clean = ~dirty_[led / 64] >> (led % 64);
+            if (clean != 0)
+                return std::min(size(), led + std::countr_zero(clean));
+
+            led = (led / 64 + 1) * 64;
+        }
+
+        return size();
+    }
+
+    void clear_dirty(size_t first_led, size_t end_led)
+    {
+        for (size_t led = first_led; led < end_led; ++led)
+            dirty_[led / 64] &= ~(uint64_t{1} << (led % 64));
+    }
+};
+
+// ILEDLight over one LED of a frame buffer - LEDSwitch and Button update the buffer through it
+class FrameBufferLEDLight : public ILEDLight
+{
+    LEDFrameBuffer& frame_;
+    size_t led_;
+
+public:
+    FrameBufferLEDLight(LEDFrameBuffer& frame, size_t led) : frame_{frame}, led_{led}
+    {
+        if (led >= frame.size())
+            throw std::out_of_range("unknown LED " + std::to_string(led));
+    }
+
+    void set_rgb(int r, int g, int b) override
+    {
+        frame_.set_rgb(led_, r, g, b);
+    }
+};
+
+#endif //LED_FRAME_BUFFER_HPP
@@ -0,0 +1,90 @@
+#ifndef MPSC_QUEUE_HPP
+#define MPSC_QUEUE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+// bounded lock-free queue for many producers and one consumer (Vyukov's ring with sequence per cell)
+// - try_push never blocks - returns false when the queue is full
+// - try_pop may be called only from one thread at a time
+template <typename T>
+class MpscQueue
+{
+    struct Cell
+    {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    size_t mask_;
+    std::unique_ptr<Cell[]> cells_;
+    alignas(64) std::atomic<size_t> tail_{0};
+    alignas(64) size_t head_ = 0;
+
+public:
+    explicit MpscQueue(size_t capacity)
+        : mask_{std::bit_ceil(std::max<size_t>(capacity, 2)) - 1}, cells_{std::make_unique<Cell[]>(mask_ + 1)}
+    {
+        for (size_t i = 0; i <= mask_; ++i)
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    size_t capacity() const
+    {
+        return mask_ + 1;
+    }
+
+    // number of cells claimed by successful try_push calls - includes pushes which have not stored their value yet
+    size_t pushed_count() const
+    {
+        return tail_.load(std::memory_order_acquire);
+    }
+
+    bool try_push(T value)
+    {
+        size_t position = tail_.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+
+        while (true)
+        {
+            cell = &cells_[position & mask_];
+            const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+
+            if (difference == 0)
+            {
+                if (tail_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (difference < 0)
+                return false;
+            else
+                position = tail_.load(std::memory_order_relaxed);
+        }
+
+        cell->value = std::move(value);
+        cell->sequence.store(position + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    bool try_pop(T& value)
+    {
+        Cell& cell = cells_[head_ & mask_];
+
+        if (cell.sequence.load(std::memory_order_acquire) != head_ + 1)
+            return false;
+
+        value = std::move(cell.value);
+        cell.sequence.store(head_ + mask_ + 1, std::memory_order_release);
+        ++head_;
+
+        return true;
+    }
+};
+
+#endif //MPSC_QUEUE_HPP
@@ -0,0 +1,286 @@
+#include "button_dispatcher.hpp"
+#include "led_frame_buffer.hpp"
+#include "led_switch.hpp"
+#include "mpsc_queue.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+using namespace std;
+using namespace std::chrono_literals;
+using ::testing::InSequence;
+
+class MockDispatchedSwitch : public ISwitch
+{
+public:
+    MOCK_METHOD(void, on, (), (override));
+    MOCK_METHOD(void, off, (), (override));
+};
+
+// counts calls - safe to call from dispatcher thread while test thread reads
+class CountingSwitch : public ISwitch
+{
+public:
+    atomic<int> on_count{0};
+    atomic<int> off_count{0};
+
+    void on() override
+    {
+        ++on_count;
+    }
+
+    void off() override
+    {
+        ++off_count;
+    }
+};
+
+TEST(MpscQueueTests, EventsArePoppedInOrderUntilQueueIsEmpty)
+{
+    MpscQueue<int> queue{4};
+
+    ASSERT_TRUE(queue.try_push(1));
+    ASSERT_TRUE(queue.try_push(2));
+    ASSERT_TRUE(queue.try_push(3));
+    ASSERT_TRUE(queue.try_push(4));
+    ASSERT_FALSE(queue.try_push(5));
+
+    int value = 0;
+    for (int expected = 1; expected <= 4; ++expected)
+    {
+        ASSERT_TRUE(queue.try_pop(value));
+        ASSERT_EQ(value, expected);
+    }
+    ASSERT_FALSE(queue.try_pop(value));
+}
+
+TEST(MpscQueueTests, EventsOfAllProducersArePopped)
+{
+    constexpr int producers_count = 4;
+    constexpr int events_per_producer = 2'000;
+    MpscQueue<int> queue{64};
+    vector<int> popped_per_producer(producers_count, 0);
+
+    {
+        vector<jthread> producers;
+        for (int p = 0; p < producers_count; ++p)
+        {
+            producers.emplace_back([&queue, p] {
+                for (int i = 0; i < events_per_producer; ++i)
+                {
+                    while (!queue.try_push(p * events_per_producer + i))
+                        this_thread::yield();
+                }
+            });
+        }
+
+        vector<int> last_per_producer(producers_count, -1);
+        for (int popped = 0; popped < producers_count * events_per_producer;)
+        {
+            int value = 0;
+            if (!queue.try_pop(value))
+            {
+                this_thread::yield();
+                continue;
+            }
+
+            const int producer = value / events_per_producer;
+            ASSERT_GT(value, last_per_producer[producer]);
+            last_per_producer[producer] = value;
+            ++popped_per_producer[producer];
+            ++popped;
+        }
+    }
+
+    ASSERT_EQ(popped_per_producer, vector<int>(producers_count, events_per_producer));
+}
+
+TEST(ButtonDispatcherTests, PressedButtonTogglesItsSwitch)
+{
+    auto mock_switch = make_shared<MockDispatchedSwitch>();
+    {
+        InSequence sequence;
+        EXPECT_CALL(*mock_switch, on()).Times(1);
+        EXPECT_CALL(*mock_switch, off()).Times(1);
+    }
+
+    ButtonDispatcher dispatcher{{mock_switch}};
+
+    dispatcher.press(0);
+    dispatcher.wait_until_dispatched();
+    dispatcher.press(0);
+    dispatcher.wait_until_dispatched();
+
+    ASSERT_EQ(dispatcher.latency().count(), 2u);
+}
+
+TEST(ButtonDispatcherTests, RepeatedTogglesInOneBatchAreCoalesced)
+{
+    auto first = make_shared<CountingSwitch>();
+    auto second = make_shared<CountingSwitch>();
+    atomic<bool> is_blocked{true};
+
+    // first batch blocks the dispatcher, so all following presses end up in one batch
+    ButtonDispatcher dispatcher{{first, second}, {.max_batch_size = 64, .after_batch = [&] {
+        while (is_blocked)
+            this_thread::yield();
+    }}};
+    dispatcher.press(1);
+    while (second->on_count == 0)
+        this_thread::yield();
+
+    for (int i = 0; i < 4; ++i)
+        dispatcher.press(0);
+    for (int i = 0; i < 3; ++i)
+        dispatcher.press(1);
+
+    is_blocked = false;
+    dispatcher.wait_until_dispatched();
+
+    ASSERT_EQ(first->on_count + first->off_count, 0);
+    ASSERT_EQ(second->on_count, 1);
+    ASSERT_EQ(second->off_count, 1);
+    ASSERT_EQ(dispatcher.coalesced_count(), 6u);
+    ASSERT_EQ(dispatcher.latency().count(), 8u);
+}
+
+TEST(ButtonDispatcherTests, PressesFromManyThreadsAreAllDispatched)
+{
+    constexpr int threads_count = 4;
+    constexpr int presses_per_thread = 5'000;
+    auto counting_switch = make_shared<CountingSwitch>();
+    ButtonDispatcher dispatcher{{counting_switch}, {.queue_capacity = 128}};
+
+    {
+        vector<jthread> threads;
+        for (int t = 0; t < threads_count; ++t)
+        {
+            threads.emplace_back([&dispatcher] {
+                for (int i = 0; i < presses_per_thread; ++i)
+                    dispatcher.press(0);
+            });
+        }
+    }
+    dispatcher.wait_until_dispatched();
+
+    const int switch_calls = counting_switch->on_count + counting_switch->off_count;
+    ASSERT_EQ(dispatcher.latency().count(), static_cast<uint64_t>(threads_count * presses_per_thread));
+    ASSERT_EQ(switch_calls + dispatcher.coalesced_count(), static_cast<uint64_t>(threads_count * presses_per_thread));
+    ASSERT_EQ(counting_switch->on_count - counting_switch->off_count, 0); // even number of presses ends switched off
+}
+
+TEST(ButtonDispatcherTests, WaitReturnsOnlyAfterOwnPressIsDispatched)
+{
+    constexpr int threads_count = 4;
+    constexpr int rounds = 2'000;
+    vector<shared_ptr<CountingSwitch>> counting_switches;
+    for (int t = 0; t < threads_count; ++t)
+        counting_switches.push_back(make_shared<CountingSwitch>());
+
+    ButtonDispatcher dispatcher{{counting_switches.begin(), counting_switches.end()}};
+    atomic<int> undispatched_waits{0};
+
+    {
+        vector<jthread> threads;
+        for (int t = 0; t < threads_count; ++t)
+        {
+            // every thread presses its own button, so its presses are never coalesced
+            threads.emplace_back([&, t] {
+                CountingSwitch& own_switch = *counting_switches[t];
+                for (int round = 1; round <= rounds; ++round)
+                {
+                    dispatcher.press(static_cast<uint32_t>(t));
+                    dispatcher.wait_until_dispatched();
+
+                    if (own_switch.on_count + own_switch.off_count != round)
+                        ++undispatched_waits;
+                }
+            });
+        }
+    }
+
+    ASSERT_EQ(undispatched_waits, 0);
+}
+
+TEST(ButtonDispatcherTests, EveryPressIsLoggedIncludingCoalescedOnes)
+{
+    class CountingDispatchLogger : public FactoryMethod::ILogger
+    {
+    public:
+        atomic<int> clicked_count{0};
+
+        void log(const string& message) override
+        {
+            if (message == "clicked")
+                ++clicked_count;
+        }
+    };
+
+    auto counting_switch = make_shared<CountingSwitch>();
+    CountingDispatchLogger logger;
+    {
+        ButtonDispatcher dispatcher{{counting_switch}, {.logger = &logger}};
+
+        for (int i = 0; i < 5; ++i)
+            dispatcher.press(0);
+        dispatcher.wait_until_dispatched();
+    }
+
+    ASSERT_EQ(logger.clicked_count, 5);
+    ASSERT_EQ(counting_switch->on_count - counting_switch->off_count, 1); // odd number of presses ends switched on
+}
+
+TEST(ButtonDispatcherTests, UnknownButtonIsRejected)
+{
+    ButtonDispatcher dispatcher{{make_shared<CountingSwitch>()}};
+
+    ASSERT_THROW(dispatcher.press(1), out_of_range);
+}
+
+TEST(ButtonDispatcherTests, FrameIsFlushedAfterEveryBatch)
+{
+    class CountingSink : public ILEDFrameSink
+    {
+    public:
+        size_t written = 0;
+
+        void write(const LEDRange& range) override
+        {
+            written += range.size();
+        }
+    };
+
+    LEDFrameBuffer frame{8};
+    FrameBufferLEDLight light{frame, 5};
+    CountingSink sink;
+    {
+        ButtonDispatcher dispatcher{{make_shared<LEDSwitch>(light)}, {.after_batch = [&] { frame.flush(sink); }}};
+
+        dispatcher.press(0);
+        dispatcher.wait_until_dispatched();
+    }
+
+    ASSERT_EQ(frame.rgb(5), (LEDFrameBuffer::RGB{255, 255, 255}));
+    ASSERT_EQ(sink.written, 1u);
+}
+
+TEST(LatencyHistogramTests, PercentilesAreWithinBucketPrecision)
+{
+    LatencyHistogram histogram;
+    for (int i = 1; i <= 1000; ++i)
+        histogram.record(chrono::nanoseconds{i * 1000});
+
+    ASSERT_EQ(histogram.count(), 1000u);
+    ASSERT_NEAR(histogram.percentile(0.5).count(), 500'000, 500'000 / 16);
+    ASSERT_NEAR(histogram.percentile(0.99).count(), 990'000, 990'000 / 16);
+    ASSERT_EQ(histogram.percentile(1.0), 1'000'000ns);
+    ASSERT_EQ(histogram.max(), 1'000'000ns);
+    ASSERT_EQ(LatencyHistogram{}.percentile(0.5), 0ns);
+}
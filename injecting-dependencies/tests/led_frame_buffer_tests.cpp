@@ -0,0 +1,124 @@
+#include "button.hpp"
+#include "led_frame_buffer.hpp"
+#include "led_switch.hpp"
+
+#include <sstream>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+using namespace std;
+using ::testing::ElementsAre;
+using ::testing::IsEmpty;
+
+// records ranges passed to the sink as (first_led, colors)
+class RecordingLEDFrameSink : public ILEDFrameSink
+{
+public:
+    struct Write
+    {
+        size_t first_led;
+        vector<LEDFrameBuffer::RGB> colors;
+
+        bool operator==(const Write&) const = default;
+    };
+
+    vector<Write> writes;
+
+    void write(const LEDRange& range) override
+    {
+        Write write{range.first_led, {}};
+        for (size_t i = 0; i < range.size(); ++i)
+            write.colors.push_back({range.reds[i], range.greens[i], range.blues[i]});
+
+        writes.push_back(write);
+    }
+};
+
+using RGB = LEDFrameBuffer::RGB;
+using Write = RecordingLEDFrameSink::Write;
+
+class LEDFrameBufferTests : public ::testing::Test
+{
+protected:
+    LEDFrameBuffer frame_{200};
+    RecordingLEDFrameSink sink_;
+};
+
+TEST_F(LEDFrameBufferTests, FlushWritesOnlyChangedRanges)
+{
+    frame_.set_rgb(3, 255, 0, 0);
+    frame_.set_rgb(4, 0, 255, 0);
+    frame_.set_rgb(150, 0, 0, 255);
+
+    ASSERT_EQ(frame_.flush(sink_), 3u);
+    ASSERT_THAT(sink_.writes, ElementsAre(
+        Write{3, {RGB{255, 0, 0}, RGB{0, 255, 0}}},
+        Write{150, {RGB{0, 0, 255}}}));
+}
+
+TEST_F(LEDFrameBufferTests, NothingIsWrittenAfterFlushUntilChange)
+{
+    frame_.set_rgb(3, 255, 0, 0);
+    frame_.flush(sink_);
+    sink_.writes.clear();
+
+    frame_.set_rgb(3, 255, 0, 0);
+
+    ASSERT_FALSE(frame_.is_dirty());
+    ASSERT_EQ(frame_.flush(sink_), 0u);
+    ASSERT_THAT(sink_.writes, IsEmpty());
+}
+
+TEST_F(LEDFrameBufferTests, RangesSpanningManyWordsOfDirtyBitsAreWrittenAtOnce)
+{
+    frame_.fill(10, 190, 1, 2, 3);
+
+    ASSERT_EQ(frame_.flush(sink_), 190u);
+    ASSERT_EQ(sink_.writes.size(), 1u);
+    ASSERT_EQ(sink_.writes[0].first_led, 10u);
+    ASSERT_EQ(sink_.writes[0].colors.size(), 190u);
+    ASSERT_EQ(frame_.rgb(199), (RGB{1, 2, 3}));
+}
+
+TEST_F(LEDFrameBufferTests, ComponentsAreClamped)
+{
+    frame_.set_rgb(0, 300, -5, 128);
+
+    ASSERT_EQ(frame_.rgb(0), (RGB{255, 0, 128}));
+}
+
+TEST_F(LEDFrameBufferTests, LEDsOutsideFrameAreRejected)
+{
+    ASSERT_THROW(frame_.set_rgb(200, 1, 1, 1), out_of_range);
+    ASSERT_THROW(frame_.fill(100, 101, 1, 1, 1), out_of_range);
+    ASSERT_THROW((FrameBufferLEDLight{frame_, 200}), out_of_range);
+}
+
+TEST_F(LEDFrameBufferTests, ButtonClicksUpdateFrameBuffer)
+{
+    FrameBufferLEDLight light{frame_, 42};
+    Button btn{1, make_shared<LEDSwitch>(light)};
+
+    btn.click();
+
+    ASSERT_EQ(frame_.rgb(42), (RGB{255, 255, 255}));
+    ASSERT_EQ(frame_.flush(sink_), 1u);
+
+    btn.click();
+    frame_.flush(sink_);
+
+    ASSERT_THAT(sink_.writes, ElementsAre(Write{42, {RGB{255, 255, 255}}}, Write{42, {RGB{0, 0, 0}}}));
+}
+
+TEST_F(LEDFrameBufferTests, ConsoleSinkPrintsOneLinePerRange)
+{
+    ostringstream out;
+    ConsoleLEDFrameSink console{out};
+    frame_.fill(7, 2, 255, 255, 255);
+
+    frame_.flush(console);
+
+    ASSERT_EQ(out.str(), "Setting(ids: 7-8; (255, 255, 255) (255, 255, 255))\n");
+}
@@ -0,0 +1,86 @@
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "concurrent_warehouse.hpp"
+#include "dense_warehouse.hpp"
+#include "order.hpp"
+#include "product_catalogue.hpp"
+
+using namespace std;
+
+// Usage: dense_warehouse_benchmark [products] [orders]
+// - fills the same random orders by product name (ConcurrentWarehouse, DenseWarehouse) and by product id (DenseWarehouse)
+
+namespace
+{
+    constexpr int repetitions = 3;
+
+    // best time of one fill in nanoseconds
+    template <typename WarehouseType>
+    double measure(const vector<Order>& orders, WarehouseType& warehouse, const vector<string>& products)
+    {
+        double best = numeric_limits<double>::max();
+
+        for (int repetition = 0; repetition < repetitions; ++repetition)
+        {
+            vector<Order> batch = orders;
+            for (const string& product : products)
+                warehouse.add(product, 1);
+
+            const auto start = chrono::steady_clock::now();
+            for (Order& order : batch)
+            {
+                if constexpr (is_same_v<WarehouseType, DenseWarehouse>)
+                    fill(order, warehouse);
+                else
+                    order.fill(warehouse);
+            }
+            const chrono::duration<double, nano> elapsed = chrono::steady_clock::now() - start;
+
+            best = min(best, elapsed.count() / batch.size());
+        }
+
+        return best;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const int products_count = argc > 1 ? stoi(argv[1]) : 1'000'000;
+    const int orders_count = argc > 2 ? stoi(argv[2]) : 1'000'000;
+
+    vector<string> products;
+    ProductCatalogue catalogue;
+    catalogue.reserve(products_count);
+    for (int i = 0; i < products_count; ++i)
+    {
+        products.push_back("SKU-" + to_string(1'000'000'000 + i));
+        catalogue.intern(products.back());
+    }
+
+    mt19937 rnd{42};
+    uniform_int_distribution<ProductId> product{0, static_cast<ProductId>(products_count - 1)};
+    vector<Order> orders_by_name;
+    vector<Order> orders_by_id;
+    for (int i = 0; i < orders_count; ++i)
+    {
+        const ProductId id = product(rnd);
+        orders_by_name.emplace_back(products[id], 1);
+        orders_by_id.emplace_back(catalogue, id, 1);
+    }
+
+    ConcurrentWarehouse concurrent_warehouse{static_cast<size_t>(products_count)};
+    DenseWarehouse dense_warehouse{catalogue};
+
+    cout << "products: " << products_count << "  orders: " << orders_count << "\n";
+    cout << "ConcurrentWarehouse by name: " << measure(orders_by_name, concurrent_warehouse, products) << " ns/fill\n";
+    cout << "DenseWarehouse by name:      " << measure(orders_by_name, dense_warehouse, products) << " ns/fill\n";
+    cout << "DenseWarehouse by id:        " << measure(orders_by_id, dense_warehouse, products) << " ns/fill\n";
+
+    return 0;
+}
@@ -0,0 +1,111 @@
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "fulfilment_engine.hpp"
+#include "order.hpp"
+#include "warehouse.hpp"
+
+using namespace std;
+
+// Usage: fulfilment_benchmark [orders] [products]
+// - fills the same batch of orders with a loop of Order::fill and with FulfilmentEngine
+// - every variant runs several times on a fresh copy of the warehouse, the best time is reported
+
+namespace
+{
+    class MapWarehouse : public Warehouse
+    {
+        unordered_map<string, size_t> inventory_;
+
+    public:
+        bool has_inventory(const std::string& product, size_t quantity) const override
+        {
+            return inventory_.at(product) >= quantity;
+        }
+
+        void add(const std::string& name, size_t count) override
+        {
+            inventory_[name] += count;
+        }
+
+        size_t get_inventory(const std::string& name) const override
+        {
+            return inventory_.at(name);
+        }
+
+        void remove(const std::string& product, size_t quantity) override
+        {
+            inventory_.at(product) -= quantity;
+        }
+    };
+
+    constexpr int repetitions = 5;
+
+    // returns best time and number of filled orders
+    template <typename Fill>
+    pair<double, size_t> measure(const MapWarehouse& warehouse, Fill fill)
+    {
+        double best = numeric_limits<double>::max();
+        size_t filled = 0;
+
+        for (int repetition = 0; repetition < repetitions; ++repetition)
+        {
+            MapWarehouse fresh_warehouse = warehouse;
+
+            const auto start = chrono::steady_clock::now();
+            filled = fill(fresh_warehouse);
+            const chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+            best = min(best, elapsed.count());
+        }
+
+        return {best, filled};
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const int orders_count = argc > 1 ? stoi(argv[1]) : 500'000;
+    const int products_count = argc > 2 ? stoi(argv[2]) : 10'000;
+
+    mt19937 rnd{42};
+    uniform_int_distribution<int> product{0, products_count - 1};
+    uniform_int_distribution<size_t> quantity{1, 10};
+
+    vector<Order> orders;
+    orders.reserve(orders_count);
+    for (int i = 0; i < orders_count; ++i)
+        orders.emplace_back("product" + to_string(product(rnd)), quantity(rnd));
+
+    MapWarehouse warehouse;
+    for (int i = 0; i < products_count; ++i)
+        warehouse.add("product" + to_string(i), 3 * orders_count / products_count);
+
+    const auto [loop_seconds, loop_filled] = measure(warehouse, [&](MapWarehouse& fresh_warehouse) {
+        size_t filled = 0;
+        for (Order order : orders)
+        {
+            order.fill(fresh_warehouse);
+            filled += order.is_filled();
+        }
+
+        return filled;
+    });
+
+    FulfilmentEngine engine;
+    const auto [engine_seconds, engine_filled] = measure(warehouse, [&](MapWarehouse& fresh_warehouse) {
+        return engine.fill(orders, fresh_warehouse).filled_count();
+    });
+
+    cout << "orders:   " << orders_count << "  products: " << products_count << "\n";
+    cout << "Order::fill loop:  filled: " << loop_filled << "  orders/s: " << orders_count / loop_seconds << "\n";
+    cout << "FulfilmentEngine:  filled: " << engine_filled << "  orders/s: " << orders_count / engine_seconds << "\n";
+
+    return loop_filled == engine_filled ? 0 : 1;
+}
@@ -0,0 +1,66 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "concurrent_warehouse.hpp"
+#include "inventory_holds.hpp"
+#include "order.hpp"
+
+using namespace std;
+using namespace std::chrono_literals;
+
+// Usage: holds_benchmark [holds]
+// - reserves holds that expire together, then measures Order::fill latency while the sweeper expires them
+
+int main(int argc, char* argv[])
+{
+    const int holds_count = argc > 1 ? stoi(argv[1]) : 1'000'000;
+    constexpr int products_count = 1000;
+
+    vector<string> products;
+    ConcurrentWarehouse warehouse{products_count};
+    for (int i = 0; i < products_count; ++i)
+    {
+        products.push_back("product" + to_string(i));
+        warehouse.add(products.back(), holds_count);
+    }
+
+    InventoryHolds holds{warehouse, {.tick = 1ms}};
+
+    const auto reserve_start = chrono::steady_clock::now();
+    for (int i = 0; i < holds_count; ++i)
+        holds.reserve(products[i % products_count], 1, 200ms);
+    const chrono::duration<double, nano> reserve_elapsed = chrono::steady_clock::now() - reserve_start;
+
+    vector<double> fill_latencies;
+    const auto expiry_start = chrono::steady_clock::now();
+    while (holds.size() != 0)
+    {
+        for (int i = 0; i < 1000; ++i)
+        {
+            Order order{products[i % products_count], 1};
+
+            const auto fill_start = chrono::steady_clock::now();
+            order.fill(warehouse);
+            const chrono::duration<double, nano> fill_elapsed = chrono::steady_clock::now() - fill_start;
+
+            fill_latencies.push_back(fill_elapsed.count());
+        }
+    }
+    const chrono::duration<double, milli> expiry_elapsed = chrono::steady_clock::now() - expiry_start;
+
+    sort(fill_latencies.begin(), fill_latencies.end());
+    const auto percentile = [&](double p) { return fill_latencies[static_cast<size_t>(p * (fill_latencies.size() - 1))]; };
+
+    cout << "holds:   " << holds_count << "\n";
+    cout << "reserve: " << reserve_elapsed.count() / holds_count << " ns/hold\n";
+    cout << "expiry:  all holds gone " << expiry_elapsed.count() << " ms after reservations\n";
+    cout << "fill during expiry: " << fill_latencies.size() << " fills  p50: " << percentile(0.5) << " ns  p99: " << percentile(0.99)
+         << " ns  max: " << fill_latencies.back() << " ns\n";
+
+    return 0;
+}
@@ -0,0 +1,124 @@
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "concurrent_warehouse.hpp"
+#include "order.hpp"
+#include "warehouse.hpp"
+
+using namespace std;
+
+// Usage: order_fill_benchmark [orders]
+// - fills the same orders through the virtual Warehouse interface (Order) and through the concrete type (HighPerfDI::Order)
+// - CounterWarehouse does almost no work, so its difference is the cost of virtual dispatch itself
+
+namespace
+{
+    // one stock counter shared by all products
+    class CounterWarehouse final : public Warehouse
+    {
+        size_t inventory_ = 0;
+
+    public:
+        bool has_inventory(const std::string&, size_t quantity) const override
+        {
+            return inventory_ >= quantity;
+        }
+
+        void add(const std::string&, size_t quantity) override
+        {
+            inventory_ += quantity;
+        }
+
+        void remove(const std::string&, size_t quantity) override
+        {
+            inventory_ -= quantity;
+        }
+
+        size_t get_inventory(const std::string&) const override
+        {
+            return inventory_;
+        }
+
+        bool try_remove(const std::string&, size_t quantity) override
+        {
+            const bool is_in_stock = inventory_ >= quantity;
+            inventory_ -= is_in_stock ? quantity : 0;
+
+            return is_in_stock;
+        }
+    };
+
+    constexpr int repetitions = 5;
+
+    // best time of one fill in nanoseconds
+    template <typename OrderType, typename WarehouseType>
+    double measure(const vector<string>& products, WarehouseType& warehouse)
+    {
+        double best = numeric_limits<double>::max();
+        size_t filled = 0;
+
+        for (int repetition = 0; repetition < repetitions; ++repetition)
+        {
+            vector<OrderType> orders;
+            orders.reserve(products.size());
+            for (const string& product : products)
+                orders.emplace_back(product, 1);
+
+            for (const string& product : products)
+                warehouse.add(product, 1);
+
+            const auto start = chrono::steady_clock::now();
+            for (OrderType& order : orders)
+                order.fill(warehouse);
+            const chrono::duration<double, nano> elapsed = chrono::steady_clock::now() - start;
+
+            for (const OrderType& order : orders)
+                filled += order.is_filled();
+
+            best = min(best, elapsed.count() / products.size());
+        }
+
+        if (filled != products.size() * repetitions)
+            cout << "unexpected number of filled orders: " << filled << "\n";
+
+        return best;
+    }
+
+    // virtual calls even if the compiler could see the dynamic type
+    [[gnu::noinline]] Warehouse& as_interface(Warehouse& warehouse)
+    {
+        return warehouse;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const int orders_count = argc > 1 ? stoi(argv[1]) : 1'000'000;
+
+    vector<string> products;
+    for (int i = 0; i < orders_count; ++i)
+        products.push_back("product" + to_string(i % 1000));
+
+    cout << "orders: " << orders_count << "\n";
+
+    {
+        CounterWarehouse warehouse;
+        const double virtual_ns = measure<Order>(products, as_interface(warehouse));
+        const double inlined_ns = measure<HighPerfDI::Order<CounterWarehouse>>(products, warehouse);
+
+        cout << "CounterWarehouse     virtual: " << virtual_ns << " ns/fill  inlined: " << inlined_ns << " ns/fill\n";
+    }
+
+    {
+        ConcurrentWarehouse warehouse{1000};
+        const double virtual_ns = measure<Order>(products, as_interface(warehouse));
+        const double inlined_ns = measure<HighPerfDI::Order<ConcurrentWarehouse>>(products, warehouse);
+
+        cout << "ConcurrentWarehouse  virtual: " << virtual_ns << " ns/fill  inlined: " << inlined_ns << " ns/fill\n";
+    }
+
+    return 0;
+}
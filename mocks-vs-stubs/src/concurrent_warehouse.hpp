@@ -0,0 +1,149 @@
+#ifndef CONCURRENT_WAREHOUSE_HPP
+#define CONCURRENT_WAREHOUSE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include "warehouse.hpp"
+
+// lock-free warehouse for concurrent orders
+// - products live in a pre-sized open-addressing table (linear probing) - slots are never moved or freed
+// - stock of every product is an atomic counter, try_remove is a single compare-and-swap loop
+// - final, so calls through ConcurrentWarehouse (e.g. from HighPerfDI::Order) are not virtual
+class ConcurrentWarehouse final : public Warehouse
+{
+    enum class SlotState : unsigned char
+    {
+        empty,
+        claimed, // key is being written
+        ready
+    };
+
+    struct Slot
+    {
+        std::atomic<SlotState> state{SlotState::empty};
+        size_t hash = 0;
+        std::string product;
+        std::atomic<size_t> quantity{0};
+    };
+
+    size_t mask_;
+    std::unique_ptr<Slot[]> slots_;
+
+public:
+    // table has room for at least products_capacity products at load factor <= 0.5
+    explicit ConcurrentWarehouse(size_t products_capacity = 1024)
+        : mask_{std::bit_ceil(std::max<size_t>(products_capacity, 1) * 2) - 1}, slots_{std::make_unique<Slot[]>(mask_ + 1)}
+    {
+    }
+
+    bool has_inventory(const std::string& product, size_t quantity) const override
+    {
+        const Slot* slot = find(product);
+
+        return slot && slot->quantity.load(std::memory_order_acquire) >= quantity;
+    }
+
+    void add(const std::string& name, size_t quantity) override
+    {
+        find_or_insert(name).quantity.fetch_add(quantity, std::memory_order_release);
+    }
+
+    void remove(const std::string& product, size_t quantity) override
+    {
+        if (!try_remove(product, quantity))
+            throw std::out_of_range("not enough inventory of " + product);
+    }
+
+    bool try_remove(const std::string& product, size_t quantity) override
+    {
+        Slot* slot = find(product);
+        if (!slot)
+            return false;
+
+        size_t current = slot->quantity.load(std::memory_order_relaxed);
+        do
+        {
+            if (current < quantity)
+                return false;
+        } while (!slot->quantity.compare_exchange_weak(current, current - quantity, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+        return true;
+    }
+
+    size_t get_inventory(const std::string& name) const override
+    {
+        const Slot* slot = find(name);
+        if (!slot)
+            throw std::out_of_range("unknown product " + name);
+
+        return slot->quantity.load(std::memory_order_acquire);
+    }
+
+private:
+    Slot* find(const std::string& product) const
+    {
+        const size_t hash = std::hash<std::string>{}(product);
+
+        for (size_t probe = 0; probe <= mask_; ++probe)
+        {
+            Slot& slot = slots_[(hash + probe) & mask_];
+
+            SlotState state = wait_until_written(slot);
+            if (state == SlotState::empty)
+                return nullptr;
+
+            if (slot.hash == hash && slot.product == product)
+                return &slot;
+        }
+
+        return nullptr;
+    }
+
+    Slot& find_or_insert(const std::string& product)
+    {
+        const size_t hash = std::hash<std::string>{}(product);
+
+        for (size_t probe = 0; probe <= mask_; ++probe)
+        {
+            Slot& slot = slots_[(hash + probe) & mask_];
+
+            SlotState state = slot.state.load(std::memory_order_acquire);
+            if (state == SlotState::empty && slot.state.compare_exchange_strong(state, SlotState::claimed, std::memory_order_acquire))
+            {
+                slot.hash = hash;
+                slot.product = product;
+                slot.state.store(SlotState::ready, std::memory_order_release);
+
+                return slot;
+            }
+
+            // slot was claimed by another product or by concurrent insert of the same one
+            wait_until_written(slot);
+            if (slot.hash == hash && slot.product == product)
+                return slot;
+        }
+
+        throw std::length_error("warehouse is full");
+    }
+
+    static SlotState wait_until_written(const Slot& slot)
+    {
+        SlotState state = slot.state.load(std::memory_order_acquire);
+        while (state == SlotState::claimed)
+        {
+            std::this_thread::yield();
+            state = slot.state.load(std::memory_order_acquire);
+        }
+
+        return state;
+    }
+};
+
+#endif
@@ -0,0 +1,120 @@
+#ifndef DENSE_WAREHOUSE_HPP
+#define DENSE_WAREHOUSE_HPP
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "order.hpp"
+#include "product_catalogue.hpp"
+#include "warehouse.hpp"
+
+// warehouse with stock kept in a flat array indexed by ProductId - lookups by id are a single indexed load
+// - product names are resolved through the catalogue, new names are registered in it by add
+// - not synchronized
+class DenseWarehouse final : public Warehouse
+{
+    ProductCatalogue& catalogue_;
+    std::vector<size_t> inventory_;
+
+public:
+    explicit DenseWarehouse(ProductCatalogue& catalogue)
+        : catalogue_{catalogue}, inventory_(catalogue.size(), 0)
+    {
+    }
+
+    const ProductCatalogue& catalogue() const
+    {
+        return catalogue_;
+    }
+
+    bool has_inventory(ProductId product, size_t quantity) const
+    {
+        return product < inventory_.size() && inventory_[product] >= quantity;
+    }
+
+    bool has_inventory(const std::string& product, size_t quantity) const override
+    {
+        const auto id = catalogue_.find(product);
+
+        return id && has_inventory(*id, quantity);
+    }
+
+    // throws out_of_range for id unknown to the catalogue
+    void add(ProductId product, size_t quantity)
+    {
+        if (product >= catalogue_.size())
+            throw std::out_of_range("unknown product id " + std::to_string(product));
+
+        if (product >= inventory_.size())
+            inventory_.resize(catalogue_.size(), 0);
+
+        inventory_[product] += quantity;
+    }
+
+    void add(const std::string& name, size_t quantity) override
+    {
+        add(catalogue_.intern(name), quantity);
+    }
+
+    void remove(ProductId product, size_t quantity)
+    {
+        if (!try_remove(product, quantity))
+            throw std::out_of_range("not enough inventory of product " + std::to_string(product));
+    }
+
+    void remove(const std::string& product, size_t quantity) override
+    {
+        if (!try_remove(product, quantity))
+            throw std::out_of_range("not enough inventory of " + product);
+    }
+
+    bool try_remove(ProductId product, size_t quantity)
+    {
+        if (!has_inventory(product, quantity))
+            return false;
+
+        inventory_[product] -= quantity;
+        return true;
+    }
+
+    bool try_remove(const std::string& product, size_t quantity) override
+    {
+        const auto id = catalogue_.find(product);
+
+        return id && try_remove(*id, quantity);
+    }
+
+    // throws out_of_range for unknown product
+    size_t get_inventory(ProductId product) const
+    {
+        if (product >= catalogue_.size())
+            throw std::out_of_range("unknown product id " + std::to_string(product));
+
+        return product < inventory_.size() ? inventory_[product] : 0;
+    }
+
+    size_t get_inventory(const std::string& name) const override
+    {
+        const auto id = catalogue_.find(name);
+        if (!id)
+            throw std::out_of_range("unknown product " + name);
+
+        return get_inventory(*id);
+    }
+};
+
+// Order::fill without virtual calls - no name lookup when the order was created with product id
+inline void fill(Order& order, DenseWarehouse& warehouse)
+{
+    const bool is_removed = order.product_id_ != no_product_id
+        ? warehouse.try_remove(order.product_id_, order.quantity_)
+        : warehouse.try_remove(order.product_, order.quantity_);
+
+    if (is_removed)
+    {
+        order.is_filled_ = true;
+    }
+}
+
+#endif
@@ -0,0 +1,238 @@
+#ifndef FULFILMENT_ENGINE_HPP
+#define FULFILMENT_ENGINE_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "order.hpp"
+#include "warehouse.hpp"
+
+// one bit per order - set when the order was filled
+class FillBitmap
+{
+    std::vector<uint64_t> words_;
+    size_t size_ = 0;
+
+public:
+    FillBitmap() = default;
+
+    explicit FillBitmap(size_t size)
+        : words_((size + 63) / 64), size_{size}
+    {
+    }
+
+    size_t size() const
+    {
+        return size_;
+    }
+
+    bool is_filled(size_t index) const
+    {
+        return (words_[index / 64] >> (index % 64)) & 1u;
+    }
+
+    void set_filled(size_t index)
+    {
+        words_[index / 64] |= uint64_t{1} << (index % 64);
+    }
+
+    size_t filled_count() const
+    {
+        size_t count = 0;
+        for (uint64_t word : words_)
+            count += std::popcount(word);
+
+        return count;
+    }
+};
+
+// fills a batch of orders against one warehouse
+// - orders are grouped by product, stock of every product is read once and taken with one try_remove
+// - unknown products (get_inventory throws std::out_of_range) have no stock
+// - when stock is too low for all orders of a product the policy decides deterministically which are filled
+class FulfilmentEngine
+{
+public:
+    enum class Policy
+    {
+        input_order,   // same result as calling Order::fill on every order in turn
+        smallest_first // as many orders as possible - equal quantities in input order
+    };
+
+    explicit FulfilmentEngine(Policy policy = Policy::input_order)
+        : policy_{policy}
+    {
+    }
+
+    FillBitmap fill(std::span<const Order> orders, Warehouse& warehouse)
+    {
+        FillBitmap result(orders.size());
+
+        group_by_product(orders);
+
+        for (size_t group = 0; group < group_products_.size(); ++group)
+        {
+            const std::span<OrderEntry> group_orders{entries_.data() + group_starts_[group], entries_.data() + group_starts_[group + 1]};
+
+            if (policy_ == Policy::smallest_first)
+            {
+                std::sort(group_orders.begin(), group_orders.end(), [](const OrderEntry& lhs, const OrderEntry& rhs) {
+                    return std::pair{lhs.quantity, lhs.index} < std::pair{rhs.quantity, rhs.index};
+                });
+            }
+
+            fill_group(group_products_[group], group_orders, warehouse, result);
+        }
+
+        return result;
+    }
+
+private:
+    struct OrderEntry
+    {
+        size_t quantity;
+        uint32_t index;
+    };
+
+    static constexpr uint32_t no_group = UINT32_MAX;
+    static constexpr size_t initial_group_slots = 1024;
+
+    struct GroupSlot
+    {
+        size_t hash = 0;
+        uint32_t group = no_group;
+    };
+
+    Policy policy_;
+    // buffers reused between batches
+    // open-addressing table from product to group - names are copied so lookups do not touch orders again
+    std::vector<GroupSlot> group_slots_;
+    std::vector<std::string> group_products_;
+    std::vector<uint32_t> group_of_order_;
+    std::vector<uint32_t> group_starts_;
+    std::vector<uint32_t> next_positions_;
+    std::vector<OrderEntry> entries_;
+
+    // stable counting sort of orders by product - orders of a group are contiguous in entries_ starting at group_starts_[group]
+    void group_by_product(std::span<const Order> orders)
+    {
+        if (orders.size() > UINT32_MAX)
+            throw std::length_error("too many orders in batch");
+
+        group_slots_.assign(initial_group_slots, GroupSlot{});
+        group_products_.clear();
+        group_of_order_.resize(orders.size());
+
+        for (size_t i = 0; i < orders.size(); ++i)
+            group_of_order_[i] = group_of(orders[i].product());
+
+        group_starts_.assign(group_products_.size() + 1, 0);
+        for (uint32_t group : group_of_order_)
+            ++group_starts_[group + 1];
+
+        for (size_t group = 1; group < group_starts_.size(); ++group)
+            group_starts_[group] += group_starts_[group - 1];
+
+        entries_.resize(orders.size());
+        next_positions_ = group_starts_;
+        for (size_t i = 0; i < orders.size(); ++i)
+            entries_[next_positions_[group_of_order_[i]]++] = OrderEntry{orders[i].quantity(), static_cast<uint32_t>(i)};
+    }
+
+    uint32_t group_of(const std::string& product)
+    {
+        const size_t hash = std::hash<std::string>{}(product);
+        const size_t mask = group_slots_.size() - 1;
+
+        for (size_t slot = hash & mask;; slot = (slot + 1) & mask)
+        {
+            GroupSlot& group_slot = group_slots_[slot];
+
+            if (group_slot.group == no_group)
+            {
+                group_slot = GroupSlot{hash, static_cast<uint32_t>(group_products_.size())};
+                group_products_.push_back(product);
+
+                const uint32_t group = group_slot.group;
+                if (group_products_.size() * 2 > group_slots_.size())
+                    grow_group_slots();
+
+                return group;
+            }
+
+            if (group_slot.hash == hash && group_products_[group_slot.group] == product)
+                return group_slot.group;
+        }
+    }
+
+    void grow_group_slots()
+    {
+        std::vector<GroupSlot> slots(group_slots_.size() * 2);
+        const size_t mask = slots.size() - 1;
+
+        for (const GroupSlot& group_slot : group_slots_)
+        {
+            if (group_slot.group == no_group)
+                continue;
+
+            size_t slot = group_slot.hash & mask;
+            while (slots[slot].group != no_group)
+                slot = (slot + 1) & mask;
+
+            slots[slot] = group_slot;
+        }
+
+        group_slots_.swap(slots);
+    }
+
+    static void fill_group(const std::string& product, std::span<const OrderEntry> group_orders, Warehouse& warehouse, FillBitmap& result)
+    {
+        size_t available = 0;
+
+        // retried only when stock was taken concurrently between reading it and removing it
+        while (true)
+        {
+            try
+            {
+                available = warehouse.get_inventory(product);
+            }
+            catch (const std::out_of_range&)
+            {
+                return; // like Order::fill - try_remove of unknown product fails even for zero quantity
+            }
+
+            // orders of zero quantity are filled even without stock, as by Order::fill
+            const size_t taken = allocate(group_orders, available, nullptr);
+            if (taken == 0 || warehouse.try_remove(product, taken))
+                break;
+        }
+
+        allocate(group_orders, available, &result);
+    }
+
+    // single greedy pass over orders of one product - returns quantity taken
+    static size_t allocate(std::span<const OrderEntry> group_orders, size_t available, FillBitmap* result)
+    {
+        size_t taken = 0;
+        for (const OrderEntry& order : group_orders)
+        {
+            if (order.quantity <= available - taken)
+            {
+                taken += order.quantity;
+                if (result)
+                    result->set_filled(order.index);
+            }
+        }
+
+        return taken;
+    }
+};
+
+#endif
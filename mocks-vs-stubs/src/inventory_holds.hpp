@@ -0,0 +1,341 @@
+#ifndef INVENTORY_HOLDS_HPP
+#define INVENTORY_HOLDS_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <stop_token>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "warehouse.hpp"
+
+using HoldId = uint64_t;
+
+constexpr HoldId no_hold = 0;
+
+// two-phase removal of stock: reserve takes stock out of the warehouse for a limited time,
+// commit keeps it removed, release or expiry puts it back
+// - reserved stock is already gone from the warehouse, so Order::fill never waits for holds
+// - reserve, commit and release are O(1) - holds live in a slab of fixed-size blocks (never relocated when it grows)
+//   and in intrusive lists of a hashed timing wheel
+// - background sweeper expires holds tick by tick, visiting only the wheel slot of the current tick
+//   and returning stock in small batches outside the lock
+// - thread-safe if the warehouse is (e.g. ConcurrentWarehouse)
+class InventoryHolds
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Options
+    {
+        Clock::duration tick = std::chrono::milliseconds{10};
+        size_t wheel_slots = 4096;
+        size_t max_expirations_per_lock = 256;
+        bool run_sweeper = true; // without sweeper holds expire only in expire_until
+    };
+
+    explicit InventoryHolds(Warehouse& warehouse)
+        : InventoryHolds(warehouse, Options{})
+    {
+    }
+
+    InventoryHolds(Warehouse& warehouse, Options options)
+        : warehouse_{warehouse}, options_{options}, epoch_{Clock::now()}, wheel_(options.wheel_slots, no_index)
+    {
+        if (options_.tick <= Clock::duration::zero() || options_.wheel_slots == 0 || options_.max_expirations_per_lock == 0)
+            throw std::invalid_argument("invalid options of inventory holds");
+
+        if (options_.run_sweeper)
+            sweeper_ = std::jthread([this](std::stop_token stop_token) { sweep(stop_token); });
+    }
+
+    InventoryHolds(const InventoryHolds&) = delete;
+    InventoryHolds& operator=(const InventoryHolds&) = delete;
+
+    // holds that are neither committed nor expired are released
+    ~InventoryHolds()
+    {
+        if (sweeper_.joinable())
+        {
+            sweeper_.request_stop();
+            sweeper_.join();
+        }
+
+        for (Hold& hold : holds_)
+        {
+            if (hold.is_active)
+                warehouse_.add(hold.product, hold.quantity);
+        }
+    }
+
+    // returns no_hold if there is not enough stock
+    HoldId reserve(const std::string& product, size_t quantity, Clock::duration time_to_live)
+    {
+        if (!warehouse_.try_remove(product, quantity))
+            return no_hold;
+
+        const uint64_t deadline = deadline_tick(Clock::now() + time_to_live);
+
+        std::lock_guard lock{mutex_};
+
+        const uint32_t index = allocate();
+        Hold& hold = holds_[index];
+        hold.product = product;
+        hold.quantity = quantity;
+        hold.deadline = std::max(deadline, current_tick_ + 1);
+        hold.is_active = true;
+        link(index);
+        ++active_count_;
+
+        return make_id(index, hold.generation);
+    }
+
+    // stock stays removed - false if the hold was already committed, released or expired
+    bool commit(HoldId id)
+    {
+        std::lock_guard lock{mutex_};
+
+        const uint32_t index = find(id);
+        if (index == no_index)
+            return false;
+
+        unlink(index);
+        free(index);
+
+        return true;
+    }
+
+    // stock is returned to the warehouse - false if the hold was already committed, released or expired
+    bool release(HoldId id)
+    {
+        std::string product;
+        size_t quantity = 0;
+        {
+            std::lock_guard lock{mutex_};
+
+            const uint32_t index = find(id);
+            if (index == no_index)
+                return false;
+
+            product = std::move(holds_[index].product);
+            quantity = holds_[index].quantity;
+            unlink(index);
+            free(index);
+        }
+
+        warehouse_.add(product, quantity);
+        return true;
+    }
+
+    // expires all holds with deadline before now - returns number of expired holds
+    size_t expire_until(Clock::time_point now)
+    {
+        std::lock_guard sweep_lock{sweep_mutex_};
+
+        const uint64_t target_tick = elapsed_ticks(now);
+        size_t expired_count = 0;
+        std::vector<std::pair<std::string, size_t>> expired;
+
+        std::unique_lock lock{mutex_};
+        while (current_tick_ < target_tick)
+        {
+            // sweeper late by a whole wheel round - every slot is visited once for the target tick
+            const bool is_whole_round = target_tick - current_tick_ >= wheel_.size();
+            const uint64_t tick = is_whole_round ? target_tick : current_tick_ + 1;
+            const size_t slots_to_visit = is_whole_round ? wheel_.size() : 1;
+
+            // advanced first - holds reserved while the lock is released get a later deadline
+            current_tick_ = tick;
+
+            for (size_t slot_offset = 0; slot_offset < slots_to_visit; ++slot_offset)
+            {
+                const size_t slot = (tick + slot_offset) % wheel_.size();
+
+                while (collect_expired(slot, tick, expired))
+                    expired_count += return_stock(lock, expired);
+
+                expired_count += return_stock(lock, expired);
+            }
+        }
+
+        return expired_count;
+    }
+
+    size_t size() const
+    {
+        std::lock_guard lock{mutex_};
+        return active_count_;
+    }
+
+private:
+    static constexpr uint32_t no_index = std::numeric_limits<uint32_t>::max();
+
+    struct Hold
+    {
+        std::string product;
+        size_t quantity = 0;
+        uint64_t deadline = 0; // tick
+        uint32_t generation = 0;
+        uint32_t previous = no_index;
+        uint32_t next = no_index; // next in wheel slot or in free list
+        bool is_active = false;
+    };
+
+    Warehouse& warehouse_;
+    Options options_;
+    Clock::time_point epoch_;
+
+    mutable std::mutex mutex_;
+    std::deque<Hold> holds_; // slab - growing it does not move holds
+    std::vector<uint32_t> wheel_; // heads of doubly-linked lists of holds
+    uint32_t free_head_ = no_index;
+    size_t active_count_ = 0;
+    uint64_t current_tick_ = 0; // all holds with deadline <= current_tick_ are expired
+
+    std::mutex sweep_mutex_;
+    std::jthread sweeper_;
+
+    static HoldId make_id(uint32_t index, uint32_t generation)
+    {
+        return (static_cast<HoldId>(generation) << 32) | (static_cast<HoldId>(index) + 1);
+    }
+
+    uint64_t elapsed_ticks(Clock::time_point time) const
+    {
+        return time <= epoch_ ? 0 : static_cast<uint64_t>((time - epoch_) / options_.tick);
+    }
+
+    uint64_t deadline_tick(Clock::time_point time) const
+    {
+        const uint64_t ticks = elapsed_ticks(time);
+        return epoch_ + ticks * options_.tick < time ? ticks + 1 : ticks;
+    }
+
+    uint32_t find(HoldId id) const
+    {
+        const uint64_t index = (id & 0xFFFF'FFFFu) - 1;
+        const auto generation = static_cast<uint32_t>(id >> 32);
+
+        if (id == no_hold || index >= holds_.size() || !holds_[index].is_active || holds_[index].generation != generation)
+            return no_index;
+
+        return static_cast<uint32_t>(index);
+    }
+
+    uint32_t allocate()
+    {
+        if (free_head_ != no_index)
+        {
+            const uint32_t index = free_head_;
+            free_head_ = holds_[index].next;
+            return index;
+        }
+
+        if (holds_.size() == no_index)
+            throw std::length_error("too many holds");
+
+        holds_.emplace_back();
+        return static_cast<uint32_t>(holds_.size() - 1);
+    }
+
+    void free(uint32_t index)
+    {
+        Hold& hold = holds_[index];
+        hold.product.clear();
+        hold.is_active = false;
+        ++hold.generation;
+        hold.previous = no_index;
+        hold.next = free_head_;
+        free_head_ = index;
+        --active_count_;
+    }
+
+    void link(uint32_t index)
+    {
+        Hold& hold = holds_[index];
+        uint32_t& head = wheel_[hold.deadline % wheel_.size()];
+
+        hold.previous = no_index;
+        hold.next = head;
+        if (head != no_index)
+            holds_[head].previous = index;
+        head = index;
+    }
+
+    void unlink(uint32_t index)
+    {
+        Hold& hold = holds_[index];
+
+        if (hold.previous != no_index)
+            holds_[hold.previous].next = hold.next;
+        else
+            wheel_[hold.deadline % wheel_.size()] = hold.next;
+
+        if (hold.next != no_index)
+            holds_[hold.next].previous = hold.previous;
+    }
+
+    // moves expired holds of slot to expired - true if the batch is full and slot has to be visited again
+    bool collect_expired(size_t slot, uint64_t tick, std::vector<std::pair<std::string, size_t>>& expired)
+    {
+        uint32_t index = wheel_[slot];
+        while (index != no_index)
+        {
+            const uint32_t next = holds_[index].next;
+
+            if (holds_[index].deadline <= tick)
+            {
+                if (expired.size() == options_.max_expirations_per_lock)
+                    return true;
+
+                expired.emplace_back(std::move(holds_[index].product), holds_[index].quantity);
+                unlink(index);
+                free(index);
+            }
+
+            index = next;
+        }
+
+        return false;
+    }
+
+    // returns stock without holding the lock, so reserve, commit and release are not blocked by the warehouse
+    size_t return_stock(std::unique_lock<std::mutex>& lock, std::vector<std::pair<std::string, size_t>>& expired)
+    {
+        if (expired.empty())
+            return 0;
+
+        lock.unlock();
+        for (const auto& [product, quantity] : expired)
+            warehouse_.add(product, quantity);
+        lock.lock();
+
+        const size_t count = expired.size();
+        expired.clear();
+
+        return count;
+    }
+
+    void sweep(std::stop_token stop_token)
+    {
+        std::mutex wait_mutex;
+        std::condition_variable_any wait;
+
+        while (!stop_token.stop_requested())
+        {
+            expire_until(Clock::now());
+
+            std::unique_lock lock{wait_mutex};
+            wait.wait_for(lock, stop_token, options_.tick, [] { return false; });
+        }
+    }
+};
+
+#endif
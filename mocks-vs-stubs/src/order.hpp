@@ -1,15 +1,26 @@
 #ifndef ORDER_HPP
 #define ORDER_HPP
 
+#include <concepts>
+#include <stdexcept>
+#include <string>
+
+#include "product_catalogue.hpp"
 #include "warehouse.hpp"
 
+class DenseWarehouse;
+
 class Order
 {
     std::string product_;
 private:
     size_t quantity_ = 0;
+    const ProductCatalogue* catalogue_ = nullptr; // set with product id - name is resolved on demand
+    ProductId product_id_ = no_product_id;
     bool is_filled_ = false;
 
+    friend void fill(Order& order, DenseWarehouse& warehouse);
+
 public:
     Order() = default;
 
@@ -18,19 +29,32 @@ public:
     {
     }
 
+    // product id must come from the catalogue of warehouses the order is filled from - catalogue must outlive the order
+    // throws out_of_range for id unknown to the catalogue
+    Order(const ProductCatalogue& catalogue, ProductId product_id, size_t quantity)
+        : quantity_(quantity), catalogue_(&catalogue), product_id_(product_id)
+    {
+        if (product_id >= catalogue.size())
+            throw std::out_of_range("unknown product id " + std::to_string(product_id));
+    }
+
     void fill(Warehouse& warehouse)
     {
-        if (warehouse.has_inventory(product_, quantity_))
+        if (warehouse.try_remove(product(), quantity_))
         {
-            warehouse.remove(product_, quantity_);
-
             is_filled_ = true;
         }
     }
 
     const std::string& product() const
     {
-        return product_;
+        return catalogue_ ? catalogue_->name(product_id_) : product_;
+    }
+
+    // no_product_id when the order was created with product name
+    ProductId product_id() const
+    {
+        return product_id_;
     }
 
     size_t quantity() const
@@ -44,4 +68,57 @@ public:
     }
 };
 
+namespace HighPerfDI
+{
+    class WarehouseProvider;
+
+    // Order bound to a concrete warehouse type at compile time - calls are not virtual and can be inlined
+    // - warehouses without try_remove are checked with has_inventory and then removed from
+    template <typename WarehouseType = class WarehouseProvider>
+    class Order
+    {
+        std::string product_;
+        size_t quantity_ = 0;
+        bool is_filled_ = false;
+
+    public:
+        Order() = default;
+
+        Order(const std::string& product, size_t quantity)
+            : product_(product), quantity_(quantity)
+        {
+        }
+
+        void fill(WarehouseType& warehouse)
+        {
+            if constexpr (requires { { warehouse.try_remove(product_, quantity_) } -> std::convertible_to<bool>; })
+            {
+                if (warehouse.try_remove(product_, quantity_))
+                    is_filled_ = true;
+            }
+            else if (warehouse.has_inventory(product_, quantity_))
+            {
+                warehouse.remove(product_, quantity_);
+
+                is_filled_ = true;
+            }
+        }
+
+        const std::string& product() const
+        {
+            return product_;
+        }
+
+        size_t quantity() const
+        {
+            return quantity_;
+        }
+
+        bool is_filled() const
+        {
+            return is_filled_;
+        }
+    };
+}
+
 #endif
\ No newline at end of file
@@ -0,0 +1,51 @@
+#ifndef PRODUCT_CATALOGUE_HPP
+#define PRODUCT_CATALOGUE_HPP
+
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "string_interner.hpp"
+
+using ProductId = uint32_t;
+
+constexpr ProductId no_product_id = std::numeric_limits<ProductId>::max();
+
+// maps product names to dense ids (0, 1, 2, ... in order of registration) - product names interned by StringInterner
+// - names and ids stay valid for the lifetime of the catalogue
+class ProductCatalogue
+{
+    StringInterner names_;
+
+public:
+    void reserve(size_t products_count)
+    {
+        names_.reserve(products_count);
+    }
+
+    // throws length_error when all ids below no_product_id are taken
+    ProductId intern(std::string_view name)
+    {
+        return names_.intern(name);
+    }
+
+    std::optional<ProductId> find(std::string_view name) const
+    {
+        return names_.find(name);
+    }
+
+    // throws out_of_range for unknown id
+    const std::string& name(ProductId id) const
+    {
+        return names_.text(id);
+    }
+
+    size_t size() const
+    {
+        return names_.size();
+    }
+};
+
+#endif
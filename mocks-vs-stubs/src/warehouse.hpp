@@ -10,6 +10,17 @@ public:
     virtual void add(const std::string& name, size_t quantity) = 0;
     virtual void remove(const std::string& product, size_t quantity) = 0;
     virtual size_t get_inventory(const std::string& name) const = 0;
+
+    // removes quantity only if it is in stock - implementations that can do it atomically should override it
+    virtual bool try_remove(const std::string& product, size_t quantity)
+    {
+        if (!has_inventory(product, quantity))
+            return false;
+
+        remove(product, quantity);
+        return true;
+    }
+
     virtual ~Warehouse() = default;
 };
 
@@ -0,0 +1,124 @@
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "concurrent_warehouse.hpp"
+#include "order.hpp"
+#include "gtest/gtest.h"
+
+using namespace std;
+
+class ConcurrentWarehouseTests : public ::testing::Test
+{
+protected:
+    const string talisker = "Talisker";
+    const string highland_park = "Highland Park";
+
+    ConcurrentWarehouse warehouse_{16};
+
+public:
+    ConcurrentWarehouseTests()
+    {
+        warehouse_.add(talisker, 50);
+        warehouse_.add(highland_park, 25);
+    }
+};
+
+TEST_F(ConcurrentWarehouseTests, OrderIsFilledIfEnoughInWarehouse)
+{
+    Order order{talisker, 50};
+
+    order.fill(warehouse_);
+
+    ASSERT_TRUE(order.is_filled());
+    ASSERT_EQ(warehouse_.get_inventory(talisker), 0u);
+}
+
+TEST_F(ConcurrentWarehouseTests, OrderIsNotFilledIfNotEnoughInWarehouse)
+{
+    Order order{talisker, 51};
+
+    order.fill(warehouse_);
+
+    ASSERT_FALSE(order.is_filled());
+    ASSERT_EQ(warehouse_.get_inventory(talisker), 50u);
+}
+
+TEST_F(ConcurrentWarehouseTests, OrderForUnknownProductIsNotFilled)
+{
+    Order order{"Lagavulin", 1};
+
+    order.fill(warehouse_);
+
+    ASSERT_FALSE(order.is_filled());
+    ASSERT_THROW(warehouse_.get_inventory("Lagavulin"), out_of_range);
+}
+
+TEST_F(ConcurrentWarehouseTests, AddingKnownProductIncreasesInventory)
+{
+    warehouse_.add(highland_park, 5);
+
+    ASSERT_EQ(warehouse_.get_inventory(highland_park), 30u);
+}
+
+TEST_F(ConcurrentWarehouseTests, RemovingMoreThanInStockThrows)
+{
+    ASSERT_THROW(warehouse_.remove(highland_park, 26), out_of_range);
+    ASSERT_EQ(warehouse_.get_inventory(highland_park), 25u);
+}
+
+TEST_F(ConcurrentWarehouseTests, AddingProductToFullWarehouseThrows)
+{
+    ConcurrentWarehouse warehouse{1};
+    warehouse.add(talisker, 1);
+    warehouse.add(highland_park, 1);
+
+    ASSERT_THROW(warehouse.add("Lagavulin", 1), length_error);
+}
+
+TEST_F(ConcurrentWarehouseTests, ConcurrentOrdersNeverTakeMoreThanInStock)
+{
+    constexpr int threads_count = 8;
+    constexpr int orders_per_thread = 100;
+    atomic<int> filled_count{0};
+
+    {
+        vector<jthread> threads;
+        for (int t = 0; t < threads_count; ++t)
+        {
+            threads.emplace_back([&] {
+                for (int i = 0; i < orders_per_thread; ++i)
+                {
+                    Order order{talisker, 1};
+                    order.fill(warehouse_);
+                    filled_count += order.is_filled();
+                }
+            });
+        }
+    }
+
+    ASSERT_EQ(filled_count, 50);
+    ASSERT_EQ(warehouse_.get_inventory(talisker), 0u);
+}
+
+TEST_F(ConcurrentWarehouseTests, ConcurrentlyAddedProductsAreAllStored)
+{
+    constexpr int threads_count = 4;
+    constexpr int products_count = 8;
+    ConcurrentWarehouse warehouse{products_count};
+
+    {
+        vector<jthread> threads;
+        for (int t = 0; t < threads_count; ++t)
+        {
+            threads.emplace_back([&] {
+                for (int i = 0; i < products_count; ++i)
+                    warehouse.add("product" + to_string(i), 1);
+            });
+        }
+    }
+
+    for (int i = 0; i < products_count; ++i)
+        ASSERT_EQ(warehouse.get_inventory("product" + to_string(i)), static_cast<size_t>(threads_count));
+}
@@ -0,0 +1,97 @@
+#include <string>
+
+#include "dense_warehouse.hpp"
+#include "order.hpp"
+#include "product_catalogue.hpp"
+#include "gtest/gtest.h"
+
+using namespace std;
+
+class DenseWarehouseTests : public ::testing::Test
+{
+protected:
+    const string talisker = "Talisker";
+    const string highland_park = "Highland Park";
+
+    ProductCatalogue catalogue_;
+    DenseWarehouse warehouse_{catalogue_};
+
+public:
+    DenseWarehouseTests()
+    {
+        warehouse_.add(talisker, 50);
+        warehouse_.add(highland_park, 25);
+    }
+};
+
+TEST_F(DenseWarehouseTests, ProductsAddedByNameAreRegisteredInCatalogue)
+{
+    ASSERT_EQ(catalogue_.find(highland_park), 1u);
+    ASSERT_EQ(warehouse_.get_inventory(1), 25u);
+    ASSERT_EQ(warehouse_.get_inventory(highland_park), 25u);
+}
+
+TEST_F(DenseWarehouseTests, OrderWithProductIdIsFilledIfEnoughInStock)
+{
+    Order order{catalogue_, *catalogue_.find(talisker), 50};
+
+    fill(order, warehouse_);
+
+    ASSERT_TRUE(order.is_filled());
+    ASSERT_EQ(order.product(), talisker);
+    ASSERT_EQ(warehouse_.get_inventory(talisker), 0u);
+}
+
+TEST_F(DenseWarehouseTests, OrderWithProductIdIsNotFilledIfNotEnoughInStock)
+{
+    Order order{catalogue_, *catalogue_.find(talisker), 51};
+
+    fill(order, warehouse_);
+
+    ASSERT_FALSE(order.is_filled());
+    ASSERT_EQ(warehouse_.get_inventory(talisker), 50u);
+}
+
+TEST_F(DenseWarehouseTests, OrderWithProductNameIsFilledThroughCatalogue)
+{
+    Order order{highland_park, 20};
+
+    fill(order, warehouse_);
+    order.fill(static_cast<Warehouse&>(warehouse_));
+
+    ASSERT_TRUE(order.is_filled());
+    ASSERT_EQ(order.product_id(), no_product_id);
+    ASSERT_EQ(warehouse_.get_inventory(highland_park), 5u);
+}
+
+TEST_F(DenseWarehouseTests, OrderWithProductIdResolvesNameInCatalogue)
+{
+    Order order{catalogue_, *catalogue_.find(highland_park), 5};
+
+    order.fill(static_cast<Warehouse&>(warehouse_));
+
+    ASSERT_TRUE(order.is_filled());
+    ASSERT_EQ(order.product(), highland_park);
+    ASSERT_EQ(warehouse_.get_inventory(highland_park), 20u);
+    ASSERT_THROW((Order{catalogue_, ProductId{7}, 1}), out_of_range);
+}
+
+TEST_F(DenseWarehouseTests, ProductRegisteredAfterWarehouseWasCreatedHasNoStock)
+{
+    const ProductId lagavulin = catalogue_.intern("Lagavulin");
+    Order order{catalogue_, lagavulin, 1};
+
+    fill(order, warehouse_);
+
+    ASSERT_FALSE(order.is_filled());
+    ASSERT_EQ(warehouse_.get_inventory(lagavulin), 0u);
+}
+
+TEST_F(DenseWarehouseTests, UnknownProductsAreRejected)
+{
+    ASSERT_FALSE(warehouse_.has_inventory("Lagavulin", 1));
+    ASSERT_FALSE(warehouse_.has_inventory(ProductId{7}, 1));
+    ASSERT_THROW(warehouse_.get_inventory("Lagavulin"), out_of_range);
+    ASSERT_THROW(warehouse_.add(ProductId{7}, 1), out_of_range);
+    ASSERT_THROW(warehouse_.remove(talisker, 51), out_of_range);
+}
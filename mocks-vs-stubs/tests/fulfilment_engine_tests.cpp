@@ -0,0 +1,152 @@
+#include <string>
+#include <vector>
+
+#include "concurrent_warehouse.hpp"
+#include "fulfilment_engine.hpp"
+#include "order.hpp"
+#include "warehouse.hpp"
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+using namespace std;
+
+using ::testing::Return;
+using ::testing::_;
+
+class FulfilmentEngineTests : public ::testing::Test
+{
+protected:
+    const string talisker = "Talisker";
+    const string highland_park = "Highland Park";
+    const string lagavulin = "Lagavulin";
+
+    ConcurrentWarehouse warehouse_{16};
+
+public:
+    FulfilmentEngineTests()
+    {
+        warehouse_.add(talisker, 50);
+        warehouse_.add(highland_park, 25);
+    }
+
+    static vector<bool> filled(const FillBitmap& bitmap)
+    {
+        vector<bool> result;
+        for (size_t i = 0; i < bitmap.size(); ++i)
+            result.push_back(bitmap.is_filled(i));
+
+        return result;
+    }
+};
+
+TEST_F(FulfilmentEngineTests, OrdersAreFilledLikeOneByOneInInputOrder)
+{
+    const vector<Order> orders{{talisker, 30}, {highland_park, 20}, {talisker, 30}, {talisker, 20}, {highland_park, 10}, {lagavulin, 1}};
+
+    ConcurrentWarehouse one_by_one_warehouse{16};
+    one_by_one_warehouse.add(talisker, 50);
+    one_by_one_warehouse.add(highland_park, 25);
+    vector<bool> filled_one_by_one;
+    for (Order order : orders)
+    {
+        order.fill(one_by_one_warehouse);
+        filled_one_by_one.push_back(order.is_filled());
+    }
+
+    const FillBitmap result = FulfilmentEngine{}.fill(orders, warehouse_);
+
+    ASSERT_EQ(filled(result), filled_one_by_one);
+    ASSERT_EQ(filled(result), (vector<bool>{true, true, false, true, false, false}));
+    ASSERT_EQ(warehouse_.get_inventory(talisker), one_by_one_warehouse.get_inventory(talisker));
+    ASSERT_EQ(warehouse_.get_inventory(highland_park), one_by_one_warehouse.get_inventory(highland_park));
+}
+
+TEST_F(FulfilmentEngineTests, SmallestFirstPolicyFillsAsManyOrdersAsPossible)
+{
+    const vector<Order> orders{{talisker, 40}, {talisker, 20}, {talisker, 20}, {talisker, 10}, {talisker, 20}};
+
+    const FillBitmap result = FulfilmentEngine{FulfilmentEngine::Policy::smallest_first}.fill(orders, warehouse_);
+
+    ASSERT_EQ(filled(result), (vector<bool>{false, true, true, true, false}));
+    ASSERT_EQ(result.filled_count(), 3u);
+    ASSERT_EQ(warehouse_.get_inventory(talisker), 0u);
+}
+
+TEST_F(FulfilmentEngineTests, BitmapHoldsResultsOfLargeBatch)
+{
+    vector<Order> orders(130, Order{highland_park, 1});
+    orders.push_back(Order{talisker, 1});
+
+    const FillBitmap result = FulfilmentEngine{}.fill(orders, warehouse_);
+
+    ASSERT_EQ(result.size(), 131u);
+    ASSERT_EQ(result.filled_count(), 26u);
+    ASSERT_TRUE(result.is_filled(24));
+    ASSERT_FALSE(result.is_filled(25));
+    ASSERT_TRUE(result.is_filled(130));
+}
+
+TEST_F(FulfilmentEngineTests, ZeroQuantityOrdersAreFilledLikeOneByOne)
+{
+    warehouse_.remove(highland_park, 25);
+    const vector<Order> orders{{highland_park, 0}, {highland_park, 1}, {talisker, 0}, {lagavulin, 0}};
+
+    vector<bool> filled_one_by_one;
+    for (Order order : orders)
+    {
+        order.fill(warehouse_);
+        filled_one_by_one.push_back(order.is_filled());
+    }
+
+    const FillBitmap result = FulfilmentEngine{}.fill(orders, warehouse_);
+
+    ASSERT_EQ(filled(result), filled_one_by_one);
+    ASSERT_EQ(filled(result), (vector<bool>{true, false, true, false}));
+    ASSERT_EQ(warehouse_.get_inventory(talisker), 50u);
+}
+
+TEST_F(FulfilmentEngineTests, EmptyBatchFillsNothing)
+{
+    const FillBitmap result = FulfilmentEngine{}.fill({}, warehouse_);
+
+    ASSERT_EQ(result.size(), 0u);
+    ASSERT_EQ(warehouse_.get_inventory(talisker), 50u);
+}
+
+struct MockBatchWarehouse : Warehouse
+{
+    MOCK_METHOD(bool, has_inventory, (const std::string&, size_t), (const, override));
+    MOCK_METHOD(void, add, (const std::string&, size_t), (override));
+    MOCK_METHOD(void, remove, (const std::string&, size_t), (override));
+    MOCK_METHOD(size_t, get_inventory, (const std::string&), (const, override));
+    MOCK_METHOD(bool, try_remove, (const std::string&, size_t), (override));
+};
+
+TEST(FulfilmentEngineInteractionsTests, EveryProductIsResolvedAndTakenOnce)
+{
+    const vector<Order> orders{{"Talisker", 10}, {"Highland Park", 5}, {"Talisker", 15}, {"Talisker", 100}};
+    MockBatchWarehouse warehouse;
+
+    EXPECT_CALL(warehouse, get_inventory("Talisker")).WillOnce(Return(50));
+    EXPECT_CALL(warehouse, get_inventory("Highland Park")).WillOnce(Return(5));
+    EXPECT_CALL(warehouse, try_remove("Talisker", 25)).WillOnce(Return(true));
+    EXPECT_CALL(warehouse, try_remove("Highland Park", 5)).WillOnce(Return(true));
+    EXPECT_CALL(warehouse, has_inventory(_, _)).Times(0);
+
+    FulfilmentEngine{}.fill(orders, warehouse);
+}
+
+TEST(FulfilmentEngineInteractionsTests, StockIsReadAgainWhenItChangedBeforeRemoval)
+{
+    const vector<Order> orders{{"Talisker", 10}, {"Talisker", 15}};
+    MockBatchWarehouse warehouse;
+
+    EXPECT_CALL(warehouse, get_inventory("Talisker")).WillOnce(Return(50)).WillOnce(Return(12));
+    EXPECT_CALL(warehouse, try_remove("Talisker", 25)).WillOnce(Return(false));
+    EXPECT_CALL(warehouse, try_remove("Talisker", 10)).WillOnce(Return(true));
+
+    const FillBitmap result = FulfilmentEngine{}.fill(orders, warehouse);
+
+    ASSERT_TRUE(result.is_filled(0));
+    ASSERT_FALSE(result.is_filled(1));
+}
@@ -0,0 +1,106 @@
+#include <map>
+#include <string>
+
+#include "concurrent_warehouse.hpp"
+#include "order.hpp"
+#include "warehouse.hpp"
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+using namespace std;
+
+using ::testing::Return;
+using ::testing::_;
+
+// concrete warehouse without virtual functions and without try_remove
+class PlainWarehouse
+{
+    map<string, size_t> inventory_;
+
+public:
+    bool has_inventory(const std::string& product, size_t quantity) const
+    {
+        return inventory_.at(product) >= quantity;
+    }
+
+    void add(const std::string& name, size_t quantity)
+    {
+        inventory_[name] += quantity;
+    }
+
+    void remove(const std::string& product, size_t quantity)
+    {
+        inventory_.at(product) -= quantity;
+    }
+
+    size_t get_inventory(const std::string& name) const
+    {
+        return inventory_.at(name);
+    }
+};
+
+class HighPerfOrderTests : public ::testing::Test
+{
+protected:
+    const string talisker = "Talisker";
+};
+
+TEST_F(HighPerfOrderTests, OrderOverConcreteWarehouseIsFilledIfEnoughInStock)
+{
+    ConcurrentWarehouse warehouse{4};
+    warehouse.add(talisker, 50);
+    HighPerfDI::Order<ConcurrentWarehouse> order{talisker, 50};
+
+    order.fill(warehouse);
+
+    ASSERT_TRUE(order.is_filled());
+    ASSERT_EQ(warehouse.get_inventory(talisker), 0u);
+}
+
+TEST_F(HighPerfOrderTests, OrderOverConcreteWarehouseIsNotFilledIfNotEnoughInStock)
+{
+    ConcurrentWarehouse warehouse{4};
+    warehouse.add(talisker, 50);
+    HighPerfDI::Order<ConcurrentWarehouse> order{talisker, 51};
+
+    order.fill(warehouse);
+
+    ASSERT_FALSE(order.is_filled());
+    ASSERT_EQ(warehouse.get_inventory(talisker), 50u);
+}
+
+TEST_F(HighPerfOrderTests, WarehouseWithoutTryRemoveIsCheckedBeforeRemoving)
+{
+    PlainWarehouse warehouse;
+    warehouse.add(talisker, 50);
+    HighPerfDI::Order<PlainWarehouse> filled_order{talisker, 30};
+    HighPerfDI::Order<PlainWarehouse> not_filled_order{talisker, 30};
+
+    filled_order.fill(warehouse);
+    not_filled_order.fill(warehouse);
+
+    ASSERT_TRUE(filled_order.is_filled());
+    ASSERT_FALSE(not_filled_order.is_filled());
+    ASSERT_EQ(warehouse.get_inventory(talisker), 20u);
+}
+
+struct MockPolicyWarehouse : Warehouse
+{
+    MOCK_METHOD(bool, has_inventory, (const std::string&, size_t), (const, override));
+    MOCK_METHOD(void, add, (const std::string&, size_t), (override));
+    MOCK_METHOD(void, remove, (const std::string&, size_t), (override));
+    MOCK_METHOD(size_t, get_inventory, (const std::string&), (const, override));
+};
+
+TEST_F(HighPerfOrderTests, OrderOverVirtualInterfaceWorksWithMocks)
+{
+    MockPolicyWarehouse warehouse;
+    HighPerfDI::Order<Warehouse> order{talisker, 50};
+
+    EXPECT_CALL(warehouse, has_inventory(talisker, 50)).WillOnce(Return(true));
+    EXPECT_CALL(warehouse, remove(talisker, 50));
+
+    order.fill(warehouse);
+
+    ASSERT_TRUE(order.is_filled());
+}
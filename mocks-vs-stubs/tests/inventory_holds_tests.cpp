@@ -0,0 +1,169 @@
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "concurrent_warehouse.hpp"
+#include "inventory_holds.hpp"
+#include "order.hpp"
+#include "gtest/gtest.h"
+
+using namespace std;
+using namespace std::chrono_literals;
+
+class InventoryHoldsTests : public ::testing::Test
+{
+protected:
+    const string talisker = "Talisker";
+    const string highland_park = "Highland Park";
+
+    ConcurrentWarehouse warehouse_{16};
+    InventoryHolds holds_{warehouse_, {.tick = 1s, .wheel_slots = 8, .run_sweeper = false}};
+
+public:
+    InventoryHoldsTests()
+    {
+        warehouse_.add(talisker, 50);
+        warehouse_.add(highland_park, 25);
+    }
+};
+
+TEST_F(InventoryHoldsTests, ReservedStockIsNotAvailableForOrders)
+{
+    const HoldId hold = holds_.reserve(talisker, 30, 60s);
+    Order order{talisker, 30};
+
+    order.fill(warehouse_);
+
+    ASSERT_NE(hold, no_hold);
+    ASSERT_FALSE(order.is_filled());
+    ASSERT_EQ(warehouse_.get_inventory(talisker), 20u);
+    ASSERT_EQ(holds_.size(), 1u);
+}
+
+TEST_F(InventoryHoldsTests, ReservationFailsIfNotEnoughInStock)
+{
+    ASSERT_EQ(holds_.reserve(talisker, 51, 60s), no_hold);
+    ASSERT_EQ(holds_.reserve("Lagavulin", 1, 60s), no_hold);
+    ASSERT_EQ(warehouse_.get_inventory(talisker), 50u);
+}
+
+TEST_F(InventoryHoldsTests, CommittedStockStaysRemoved)
+{
+    const HoldId hold = holds_.reserve(talisker, 30, 5s);
+
+    ASSERT_TRUE(holds_.commit(hold));
+    ASSERT_EQ(holds_.expire_until(InventoryHolds::Clock::now() + 1h), 0u);
+    ASSERT_EQ(warehouse_.get_inventory(talisker), 20u);
+    ASSERT_EQ(holds_.size(), 0u);
+}
+
+TEST_F(InventoryHoldsTests, ReleasedStockIsReturned)
+{
+    const HoldId hold = holds_.reserve(talisker, 30, 5s);
+
+    ASSERT_TRUE(holds_.release(hold));
+    ASSERT_EQ(warehouse_.get_inventory(talisker), 50u);
+}
+
+TEST_F(InventoryHoldsTests, HoldCanBeFinishedOnlyOnce)
+{
+    const HoldId committed = holds_.reserve(talisker, 10, 5s);
+    const HoldId released = holds_.reserve(talisker, 10, 5s);
+    holds_.commit(committed);
+    holds_.release(released);
+
+    // slot of a finished hold is reused - old ids must not match the new hold
+    const HoldId reused = holds_.reserve(talisker, 10, 5s);
+
+    ASSERT_FALSE(holds_.commit(committed));
+    ASSERT_FALSE(holds_.release(committed));
+    ASSERT_FALSE(holds_.release(released));
+    ASSERT_FALSE(holds_.commit(no_hold));
+    ASSERT_TRUE(holds_.commit(reused));
+    ASSERT_EQ(warehouse_.get_inventory(talisker), 30u);
+}
+
+TEST_F(InventoryHoldsTests, HoldsExpireAfterTimeToLive)
+{
+    const auto now = InventoryHolds::Clock::now();
+    const HoldId short_hold = holds_.reserve(talisker, 10, 3s);
+    const HoldId long_hold = holds_.reserve(talisker, 20, 20s); // longer than one round of the wheel
+
+    ASSERT_EQ(holds_.expire_until(now + 2s), 0u);
+    ASSERT_EQ(holds_.expire_until(now + 5s), 1u);
+    ASSERT_EQ(warehouse_.get_inventory(talisker), 30u);
+
+    ASSERT_EQ(holds_.expire_until(now + 15s), 0u);
+    ASSERT_EQ(holds_.expire_until(now + 22s), 1u);
+    ASSERT_EQ(warehouse_.get_inventory(talisker), 50u);
+
+    ASSERT_FALSE(holds_.commit(short_hold));
+    ASSERT_FALSE(holds_.release(long_hold));
+}
+
+TEST_F(InventoryHoldsTests, ManyHoldsExpireInBatches)
+{
+    InventoryHolds holds{warehouse_, {.tick = 1s, .wheel_slots = 8, .max_expirations_per_lock = 3, .run_sweeper = false}};
+    for (int i = 0; i < 25; ++i)
+        holds.reserve(highland_park, 1, 2s);
+
+    ASSERT_EQ(warehouse_.get_inventory(highland_park), 0u);
+    ASSERT_EQ(holds.expire_until(InventoryHolds::Clock::now() + 1h), 25u);
+    ASSERT_EQ(warehouse_.get_inventory(highland_park), 25u);
+}
+
+TEST_F(InventoryHoldsTests, ActiveHoldsAreReleasedOnDestruction)
+{
+    {
+        InventoryHolds holds{warehouse_, {.run_sweeper = false}};
+        holds.reserve(talisker, 30, 60s);
+    }
+
+    ASSERT_EQ(warehouse_.get_inventory(talisker), 50u);
+}
+
+TEST_F(InventoryHoldsTests, SweeperExpiresHoldsInBackground)
+{
+    InventoryHolds holds{warehouse_, {.tick = 1ms}};
+    holds.reserve(talisker, 50, 5ms);
+
+    for (int i = 0; i < 1000 && warehouse_.get_inventory(talisker) != 50u; ++i)
+        this_thread::sleep_for(1ms);
+
+    ASSERT_EQ(warehouse_.get_inventory(talisker), 50u);
+    ASSERT_EQ(holds.size(), 0u);
+}
+
+TEST_F(InventoryHoldsTests, ConcurrentHoldsNeverLoseStock)
+{
+    constexpr int threads_count = 8;
+    constexpr int operations_per_thread = 2000;
+    atomic<size_t> committed{0};
+
+    {
+        InventoryHolds holds{warehouse_, {.tick = 1ms}};
+        {
+            vector<jthread> threads;
+            for (int t = 0; t < threads_count; ++t)
+            {
+                threads.emplace_back([&, t] {
+                    for (int i = 0; i < operations_per_thread; ++i)
+                    {
+                        const HoldId hold = holds.reserve(talisker, 1, (i % 3 == 0) ? 1ms : 1h);
+                        if (hold == no_hold)
+                            continue;
+
+                        if ((i + t) % 50 == 0)
+                            committed += holds.commit(hold);
+                        else if (i % 3 != 0)
+                            holds.release(hold);
+                    }
+                });
+            }
+        }
+    }
+
+    ASSERT_EQ(warehouse_.get_inventory(talisker) + committed, 50u);
+}
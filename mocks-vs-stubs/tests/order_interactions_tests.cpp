@@ -18,6 +18,11 @@ struct MockWarehouse : Warehouse
     MOCK_METHOD(size_t, get_inventory, (const std::string&), (const, override));
 };
 
+struct MockAtomicWarehouse : MockWarehouse
+{
+    MOCK_METHOD(bool, try_remove, (const std::string&, size_t), (override));
+};
+
 using ::testing::Return;
 using ::testing::_;
 using ::testing::NiceMock;
@@ -76,3 +81,17 @@ TEST_F(OrderInteractionsTests, OrderIsNotFilledIfNotEnoughInStock)
 
     ASSERT_FALSE(order.is_filled());
 }
+
+TEST(OrderAtomicInteractionsTests, FillingOrderTakesInventoryInSingleCall)
+{
+    Order order{"Talisker", 50};
+    MockAtomicWarehouse warehouse;
+
+    EXPECT_CALL(warehouse, try_remove("Talisker", 50)).WillOnce(Return(true));
+    EXPECT_CALL(warehouse, has_inventory(_, _)).Times(0);
+    EXPECT_CALL(warehouse, remove(_, _)).Times(0);
+
+    order.fill(warehouse);
+
+    ASSERT_TRUE(order.is_filled());
+}
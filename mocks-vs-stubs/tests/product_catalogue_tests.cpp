@@ -0,0 +1,40 @@
+#include <string>
+
+#include "product_catalogue.hpp"
+#include "gtest/gtest.h"
+
+using namespace std;
+
+class ProductCatalogueTests : public ::testing::Test
+{
+protected:
+    ProductCatalogue catalogue_;
+};
+
+TEST_F(ProductCatalogueTests, ProductsGetDenseIdsInOrderOfRegistration)
+{
+    ASSERT_EQ(catalogue_.intern("Talisker"), 0u);
+    ASSERT_EQ(catalogue_.intern("Highland Park"), 1u);
+    ASSERT_EQ(catalogue_.intern("Talisker"), 0u);
+    ASSERT_EQ(catalogue_.size(), 2u);
+}
+
+TEST_F(ProductCatalogueTests, NamesAreFoundByIdAndIdsByName)
+{
+    const ProductId id = catalogue_.intern("Talisker");
+    catalogue_.reserve(1000);
+    for (int i = 0; i < 1000; ++i)
+        catalogue_.intern("product" + to_string(i));
+
+    ASSERT_EQ(catalogue_.name(id), "Talisker");
+    ASSERT_EQ(catalogue_.find("Talisker"), id);
+    ASSERT_EQ(catalogue_.find("product999"), 1000u);
+}
+
+TEST_F(ProductCatalogueTests, UnknownProductsAreNotFound)
+{
+    catalogue_.intern("Talisker");
+
+    ASSERT_EQ(catalogue_.find("Lagavulin"), nullopt);
+    ASSERT_THROW(catalogue_.name(1), out_of_range);
+}
@@ -0,0 +1,78 @@
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "sharded_flight_repository.hpp"
+
+using namespace std;
+
+// Usage: repository_benchmark [threads] [read_percent] [operations_per_thread]
+// - every thread mixes adds with lookups by flight number; one lookup in a hundred is a narrow price range query
+
+namespace
+{
+    constexpr int flight_numbers = 10'000;
+
+    double run(ShardedFlightRepository& repository, unsigned threads_count, int read_percent, int operations, atomic<size_t>& found_total)
+    {
+        const auto start = chrono::steady_clock::now();
+        {
+            vector<jthread> threads;
+            for (unsigned t = 0; t < threads_count; ++t)
+            {
+                threads.emplace_back([&, t] {
+                    mt19937 rnd{t};
+                    uniform_int_distribution<int> number{0, flight_numbers - 1};
+                    uniform_int_distribution<int> percent{0, 99};
+                    uniform_real_distribution<double> price{50.0, 1000.0};
+                    size_t found = 0;
+
+                    for (int i = 0; i < operations; ++i)
+                    {
+                        const string no_of_flight = "LOT" + to_string(number(rnd));
+
+                        if (percent(rnd) >= read_percent)
+                            repository.add(Flight{no_of_flight, price(rnd)});
+                        else if (i % 100 == 0)
+                        {
+                            const double from = price(rnd);
+                            found += repository.find_by_price(from, from + 0.5).size();
+                        }
+                        else
+                            found += repository.find_by_number(no_of_flight).size();
+                    }
+
+                    found_total += found;
+                });
+            }
+        }
+        const chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+        return static_cast<double>(threads_count) * operations / elapsed.count();
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const unsigned threads_count = argc > 1 ? stoul(argv[1]) : max(thread::hardware_concurrency(), 1u);
+    const int read_percent = argc > 2 ? stoi(argv[2]) : 50;
+    const int operations = argc > 3 ? stoi(argv[3]) : 200'000;
+
+    cout << "threads:      " << threads_count << "\n";
+    cout << "reads:        " << read_percent << "%\n";
+
+    for (size_t shards : {size_t{1}, size_t{8}, size_t{64}})
+    {
+        ShardedFlightRepository repository{shards};
+        atomic<size_t> found{0};
+        const double ops_per_second = run(repository, threads_count, read_percent, operations, found);
+
+        cout << "shards: " << shards << "  flights: " << repository.size() << "  found: " << found << "  ops/s: " << ops_per_second << "\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,94 @@
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "flight_service.hpp"
+#include "wal_flight_repository.hpp"
+
+using namespace std;
+
+// Usage: wal_benchmark [threads] [reservations_per_thread] [durability: buffered|written|synced|all]
+// - every thread makes reservations through FlightReservationService backed by WalFlightRepository in a temporary directory
+
+namespace
+{
+    double run(WalFlightRepository& repository, unsigned threads_count, int reservations)
+    {
+        const auto start = chrono::steady_clock::now();
+        {
+            vector<jthread> threads;
+            for (unsigned t = 0; t < threads_count; ++t)
+            {
+                threads.emplace_back([&, t] {
+                    FlightReservationService service{repository};
+
+                    for (int i = 0; i < reservations; ++i)
+                    {
+                        service.make_reservation(ReservationRequest{
+                            .flight = Flight{"LOT" + to_string(i % 1000), 100.0 + t},
+                            .client = "client" + to_string(t),
+                            .timestamp = "2024/05/01 9:30am"});
+                    }
+                });
+            }
+        }
+        repository.flush();
+        const chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+        return static_cast<double>(threads_count) * reservations / elapsed.count();
+    }
+
+    string_view name(WalFlightRepository::Durability durability)
+    {
+        switch (durability)
+        {
+        case WalFlightRepository::Durability::buffered:
+            return "buffered";
+        case WalFlightRepository::Durability::written:
+            return "written";
+        case WalFlightRepository::Durability::synced:
+            return "synced";
+        }
+
+        return "";
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    using Durability = WalFlightRepository::Durability;
+
+    const unsigned threads_count = argc > 1 ? stoul(argv[1]) : max(thread::hardware_concurrency(), 1u);
+    const int reservations = argc > 2 ? stoi(argv[2]) : 2'000;
+    const string_view selected = argc > 3 ? argv[3] : "all";
+
+    cout << "threads:      " << threads_count << "\n";
+    cout << "reservations: " << reservations << " per thread\n";
+
+    const filesystem::path directory = filesystem::temp_directory_path() / ("wal_benchmark_" + to_string(::getpid()));
+
+    for (Durability durability : {Durability::buffered, Durability::written, Durability::synced})
+    {
+        if (selected != "all" && selected != name(durability))
+            continue;
+
+        filesystem::remove_all(directory);
+        double reservations_per_second = 0.0;
+        size_t stored = 0;
+        {
+            WalFlightRepository repository{directory, {.durability = durability}};
+            reservations_per_second = run(repository, threads_count, reservations);
+            stored = repository.size();
+        }
+
+        cout << "durability: " << name(durability) << "  stored: " << stored << "  reservations/s: " << reservations_per_second << "\n";
+    }
+
+    filesystem::remove_all(directory);
+
+    return 0;
+}
@@ -0,0 +1,198 @@
+#ifndef BATCHING_FLIGHT_REPOSITORY_HPP
+#define BATCHING_FLIGHT_REPOSITORY_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <future>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <stop_token>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "flight_model.hpp"
+#include "flight_repository.hpp"
+
+// FlightRepository decorator which takes storage writes off the reservation path
+// - add() only queues the flight; a background thread writes queued flights to the backend in batches
+// - a batch is written when max_batch_size flights are queued or max_delay after its first flight was queued
+// - every batch has a completion future which holds the backend exception if the write failed
+// - add_all splits flights into batches of at most max_batch_size
+class BatchingFlightRepository : public FlightRepository
+{
+public:
+    struct Options
+    {
+        size_t max_batch_size = 256;
+        std::chrono::steady_clock::duration max_delay = std::chrono::milliseconds(5);
+    };
+
+    explicit BatchingFlightRepository(FlightRepository& backend)
+        : BatchingFlightRepository(backend, Options{})
+    {
+    }
+
+    // throws invalid_argument for max_batch_size 0
+    BatchingFlightRepository(FlightRepository& backend, Options options)
+        : backend_{backend}, options_{options}
+    {
+        if (options_.max_batch_size == 0)
+            throw std::invalid_argument("batch size must be positive");
+
+        std::promise<void> nothing_pending;
+        nothing_pending.set_value();
+        last_completion_ = nothing_pending.get_future().share();
+
+        batches_.push_back(make_batch());
+        worker_ = std::jthread([this](std::stop_token stop) { run(stop); });
+    }
+
+    // remaining flights are written before destruction completes
+    ~BatchingFlightRepository() override
+    {
+        worker_.request_stop();
+        wake_.notify_one();
+    }
+
+    void add(const Flight& flight) override
+    {
+        add_all(std::span<const Flight>{&flight, 1});
+    }
+
+    // flights are split into batches of at most max_batch_size
+    void add_all(std::span<const Flight> flights) override
+    {
+        if (flights.empty())
+            return;
+
+        bool should_wake = false;
+        {
+            std::lock_guard lock{mutex_};
+
+            should_wake = batches_.front().flights.empty();
+
+            while (!flights.empty())
+            {
+                if (batches_.back().flights.size() >= options_.max_batch_size)
+                {
+                    batches_.push_back(make_batch());
+                    should_wake = true;
+                }
+
+                Batch& batch = batches_.back();
+                if (batch.flights.empty())
+                    batch.deadline = std::chrono::steady_clock::now() + options_.max_delay;
+
+                const size_t count = std::min(flights.size(), options_.max_batch_size - batch.flights.size());
+                batch.flights.insert(batch.flights.end(), flights.begin(), flights.begin() + count);
+                flights = flights.subspan(count);
+
+                should_wake = should_wake || batch.flights.size() == options_.max_batch_size;
+            }
+
+            last_completion_ = batches_.back().completion;
+        }
+
+        if (should_wake)
+            wake_.notify_one();
+    }
+
+    // completes when all flights added so far are written - ready at once when nothing is pending
+    std::shared_future<void> completion() const
+    {
+        std::lock_guard lock{mutex_};
+        return last_completion_;
+    }
+
+    // writes queued flights without waiting for thresholds
+    std::shared_future<void> flush()
+    {
+        std::shared_future<void> completion;
+        {
+            std::lock_guard lock{mutex_};
+            flush_requested_ = true;
+            completion = last_completion_;
+        }
+
+        wake_.notify_one();
+        return completion;
+    }
+
+private:
+    struct Batch
+    {
+        std::vector<Flight> flights;
+        std::chrono::steady_clock::time_point deadline;
+        std::promise<void> written;
+        std::shared_future<void> completion;
+    };
+
+    FlightRepository& backend_;
+    Options options_;
+    mutable std::mutex mutex_;
+    std::condition_variable_any wake_;
+    std::deque<Batch> batches_; // front is written next, back receives new flights
+    std::shared_future<void> last_completion_; // completion of the last batch flights were added to
+    bool flush_requested_ = false;
+    std::jthread worker_; // declared last - stops before the state it uses is destroyed
+
+    static Batch make_batch()
+    {
+        Batch batch;
+        batch.completion = batch.written.get_future().share();
+
+        return batch;
+    }
+
+    void run(std::stop_token stop)
+    {
+        std::unique_lock lock{mutex_};
+        while (true)
+        {
+            wake_.wait(lock, stop, [this] { return !batches_.front().flights.empty() || flush_requested_; });
+            wake_.wait_until(lock, stop, batches_.front().deadline, [this] {
+                return batches_.front().flights.size() >= options_.max_batch_size || flush_requested_;
+            });
+
+            Batch batch = std::move(batches_.front());
+            batches_.pop_front();
+            if (batches_.empty())
+                batches_.push_back(make_batch());
+
+            if (batches_.front().flights.empty())
+                flush_requested_ = false;
+
+            const bool is_last = stop.stop_requested() && batches_.front().flights.empty();
+
+            lock.unlock();
+            write(batch.flights, batch.written);
+
+            if (is_last)
+                return;
+
+            lock.lock();
+        }
+    }
+
+    void write(const std::vector<Flight>& flights, std::promise<void>& written)
+    {
+        try
+        {
+            if (!flights.empty())
+                backend_.add_all(flights);
+
+            written.set_value();
+        }
+        catch (...)
+        {
+            written.set_exception(std::current_exception());
+        }
+    }
+};
+
+#endif // BATCHING_FLIGHT_REPOSITORY_HPP
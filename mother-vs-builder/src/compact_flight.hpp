@@ -0,0 +1,64 @@
+#ifndef COMPACT_FLIGHT_HPP
+#define COMPACT_FLIGHT_HPP
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include "flight_model.hpp"
+#include "flight_service.hpp"
+#include "string_interner.hpp"
+
+// Flight with interned flight number and price in hundredths - 8 bytes, compared with integer compares
+struct CompactFlight
+{
+    uint32_t flight_id;
+    int32_t price_cents;
+
+    bool operator==(const CompactFlight&) const = default;
+};
+
+static_assert(sizeof(CompactFlight) == 8);
+
+struct CompactReservationRequest
+{
+    CompactFlight flight;
+    uint32_t client_id;
+    Timestamp timestamp;
+};
+
+// price is rounded to hundredths - throws out_of_range when it does not fit
+inline int32_t to_price_cents(double price)
+{
+    const double cents = std::round(price * 100.0);
+
+    if (!(cents >= std::numeric_limits<int32_t>::min() && cents <= std::numeric_limits<int32_t>::max()))
+        throw std::out_of_range("price out of range");
+
+    return static_cast<int32_t>(cents);
+}
+
+inline CompactFlight to_compact(const Flight& flight, StringInterner& flight_numbers)
+{
+    return CompactFlight{flight_numbers.intern(flight.no_of_flight), to_price_cents(flight.price)};
+}
+
+inline Flight to_flight(const CompactFlight& flight, const StringInterner& flight_numbers)
+{
+    return Flight{std::string{flight_numbers.view(flight.flight_id)}, flight.price_cents / 100.0};
+}
+
+inline CompactReservationRequest to_compact(const ReservationRequest& request, StringInterner& flight_numbers, StringInterner& clients)
+{
+    return CompactReservationRequest{to_compact(request.flight, flight_numbers), clients.intern(request.client), request.timestamp};
+}
+
+inline ReservationRequest to_reservation_request(const CompactReservationRequest& request, const StringInterner& flight_numbers,
+                                                 const StringInterner& clients)
+{
+    return ReservationRequest{to_flight(request.flight, flight_numbers), Client{clients.view(request.client_id)}, request.timestamp};
+}
+
+#endif // COMPACT_FLIGHT_HPP
@@ -4,6 +4,8 @@
 #include <string>
 #include <tuple>
 
+#include "timestamp.hpp"
+
 struct Flight
 {
     std::string no_of_flight;
@@ -16,7 +18,6 @@ struct Flight
 };
 
 using Client = std::string;
-using Timestamp = std::string;
 
 
 #endif //FLIGHT_MODEL_HPP
@@ -1,6 +1,8 @@
 #ifndef FLIGHT_REPOSITORY_HPP
 #define FLIGHT_REPOSITORY_HPP
 
+#include <span>
+
 #include "flight_model.hpp"
 
 class FlightRepository
@@ -8,6 +10,13 @@ class FlightRepository
 public:
     virtual ~FlightRepository() = default;
     virtual void add(const Flight& flight) = 0;
+
+    // bulk insert - storages which can write many flights in one round-trip override it
+    virtual void add_all(std::span<const Flight> flights)
+    {
+        for (const Flight& flight : flights)
+            add(flight);
+    }
 };
 
 #endif // FLIGHT_REPOSITORY_HPP
@@ -3,7 +3,10 @@
 
 #include "flight_model.hpp"
 #include "flight_repository.hpp"
+#include <cstdint>
+#include <span>
 #include <stdexcept>
+#include <vector>
 
 struct ReservationRequest
 {
@@ -12,6 +15,13 @@ struct ReservationRequest
     Timestamp timestamp;
 };
 
+enum class ReservationStatus : uint8_t
+{
+    accepted,
+    invalid_timestamp,
+    invalid_client
+};
+
 class FlightReservationService
 {
     FlightRepository& flight_repository_;
@@ -24,19 +34,60 @@ public:
 
     void make_reservation(const ReservationRequest& reservation_request)
     {
-        if (!is_valid(reservation_request.timestamp))
+        switch (validate(reservation_request))
+        {
+        case ReservationStatus::invalid_timestamp:
             throw std::invalid_argument("invalid timestamp");
-        
-        if (reservation_request.client.empty())
+        case ReservationStatus::invalid_client:
             throw std::invalid_argument("invalid clinet");
+        case ReservationStatus::accepted:
+            break;
+        }
 
         flight_repository_.add(reservation_request.flight);
     }
 
+    // validates all requests first and adds accepted flights to the repository in one bulk call
+    // - returns status of every request instead of throwing on the first invalid one
+    std::vector<ReservationStatus> make_reservations(std::span<const ReservationRequest> reservation_requests)
+    {
+        std::vector<ReservationStatus> statuses(reservation_requests.size());
+        size_t accepted_count = 0;
+
+        for (size_t i = 0; i < reservation_requests.size(); ++i)
+        {
+            statuses[i] = validate(reservation_requests[i]);
+            accepted_count += statuses[i] == ReservationStatus::accepted;
+        }
+
+        std::vector<Flight> accepted_flights;
+        accepted_flights.reserve(accepted_count);
+        for (size_t i = 0; i < reservation_requests.size(); ++i)
+        {
+            if (statuses[i] == ReservationStatus::accepted)
+                accepted_flights.push_back(reservation_requests[i].flight);
+        }
+
+        if (!accepted_flights.empty())
+            flight_repository_.add_all(accepted_flights);
+
+        return statuses;
+    }
+
 private:
-    bool is_valid(const Timestamp& timestamp)
+    // no branches between the checks - both are evaluated and combined with selects
+    ReservationStatus validate(const ReservationRequest& reservation_request) const
+    {
+        const bool has_valid_timestamp = is_valid(reservation_request.timestamp);
+        const bool has_valid_client = !reservation_request.client.empty();
+
+        const ReservationStatus client_status = has_valid_client ? ReservationStatus::accepted : ReservationStatus::invalid_client;
+        return has_valid_timestamp ? client_status : ReservationStatus::invalid_timestamp;
+    }
+
+    bool is_valid(const Timestamp& timestamp) const
     {
-        return timestamp == "2017/01/01 1:45am";
+        return timestamp.is_valid();
     }
 };
 
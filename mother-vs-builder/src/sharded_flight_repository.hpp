@@ -0,0 +1,160 @@
+#ifndef SHARDED_FLIGHT_REPOSITORY_HPP
+#define SHARDED_FLIGHT_REPOSITORY_HPP
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "flight_model.hpp"
+#include "flight_repository.hpp"
+
+// in-memory flight storage split into shards by hash of flight number
+// - adds of different flights lock different shards, lookups take shared locks
+// - every shard keeps a hash index by flight number and a sorted price index for range queries
+class ShardedFlightRepository : public FlightRepository
+{
+public:
+    explicit ShardedFlightRepository(size_t shards_count = 64)
+        : shards_count_{std::max<size_t>(shards_count, 1)}, shards_{std::make_unique<Shard[]>(shards_count_)}
+    {
+    }
+
+    void add(const Flight& flight) override
+    {
+        Shard& shard = shard_for(flight.no_of_flight);
+        std::unique_lock lock{shard.mutex};
+        shard.insert(flight);
+    }
+
+    // flights for one shard are inserted under one lock
+    void add_all(std::span<const Flight> flights) override
+    {
+        std::vector<size_t> order(flights.size());
+        std::vector<size_t> shard_of(flights.size());
+        for (size_t i = 0; i < flights.size(); ++i)
+        {
+            order[i] = i;
+            shard_of[i] = shard_index(flights[i].no_of_flight);
+        }
+
+        std::stable_sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) { return shard_of[lhs] < shard_of[rhs]; });
+
+        for (size_t begin = 0; begin < order.size();)
+        {
+            Shard& shard = shards_[shard_of[order[begin]]];
+            std::unique_lock lock{shard.mutex};
+
+            size_t end = begin;
+            for (; end < order.size() && shard_of[order[end]] == shard_of[order[begin]]; ++end)
+                shard.insert(flights[order[end]]);
+
+            begin = end;
+        }
+    }
+
+    // all flights with given number in order of adding
+    std::vector<Flight> find_by_number(std::string_view no_of_flight) const
+    {
+        const Shard& shard = shard_for(no_of_flight);
+        std::shared_lock lock{shard.mutex};
+
+        const auto found = shard.prices_by_number.find(no_of_flight);
+        if (found == shard.prices_by_number.end())
+            return {};
+
+        std::vector<Flight> flights;
+        flights.reserve(found->second.size());
+        for (double price : found->second)
+            flights.push_back(Flight{found->first, price});
+
+        return flights;
+    }
+
+    // flights with price in [min_price, max_price] ordered by price
+    std::vector<Flight> find_by_price(double min_price, double max_price) const
+    {
+        std::vector<Flight> flights;
+
+        for (size_t i = 0; i < shards_count_; ++i)
+        {
+            const Shard& shard = shards_[i];
+            std::shared_lock lock{shard.mutex};
+
+            const auto last = shard.by_price.upper_bound(max_price);
+            for (auto it = shard.by_price.lower_bound(min_price); it != last; ++it)
+                flights.push_back(Flight{*it->second, it->first});
+        }
+
+        std::stable_sort(flights.begin(), flights.end(), [](const Flight& lhs, const Flight& rhs) { return lhs.price < rhs.price; });
+        return flights;
+    }
+
+    size_t size() const
+    {
+        size_t count = 0;
+        for (size_t i = 0; i < shards_count_; ++i)
+        {
+            std::shared_lock lock{shards_[i].mutex};
+            count += shards_[i].by_price.size();
+        }
+
+        return count;
+    }
+
+private:
+    struct StringHash
+    {
+        using is_transparent = void;
+
+        size_t operator()(std::string_view text) const
+        {
+            return std::hash<std::string_view>{}(text);
+        }
+    };
+
+    // aligned to cache line, so locking one shard does not invalidate its neighbours
+    struct alignas(64) Shard
+    {
+        mutable std::shared_mutex mutex;
+        std::unordered_map<std::string, std::vector<double>, StringHash, std::equal_to<>> prices_by_number;
+        std::multimap<double, const std::string*> by_price; // points to keys of prices_by_number - they never move
+
+        void insert(const Flight& flight)
+        {
+            auto found = prices_by_number.find(flight.no_of_flight);
+            if (found == prices_by_number.end())
+                found = prices_by_number.emplace(flight.no_of_flight, std::vector<double>{}).first;
+
+            found->second.push_back(flight.price);
+            by_price.emplace(flight.price, &found->first);
+        }
+    };
+
+    size_t shards_count_;
+    std::unique_ptr<Shard[]> shards_;
+
+    size_t shard_index(std::string_view no_of_flight) const
+    {
+        return StringHash{}(no_of_flight) % shards_count_;
+    }
+
+    Shard& shard_for(std::string_view no_of_flight)
+    {
+        return shards_[shard_index(no_of_flight)];
+    }
+
+    const Shard& shard_for(std::string_view no_of_flight) const
+    {
+        return shards_[shard_index(no_of_flight)];
+    }
+};
+
+#endif // SHARDED_FLIGHT_REPOSITORY_HPP
@@ -0,0 +1,129 @@
+#ifndef TIMESTAMP_HPP
+#define TIMESTAMP_HPP
+
+#include <compare>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+
+// point in time parsed from fixed format "YYYY/MM/DD h:MMam" (or pm, hour 1-12), stored as seconds since 1970/01/01 UTC
+// - parsing is constexpr and allocation free; text which is not a valid date and time gives an invalid timestamp
+// - implicitly constructible from text, so reservation requests can still be written with string literals
+class Timestamp
+{
+public:
+    static constexpr int min_year = 1970;
+    static constexpr int max_year = 9999;
+
+    constexpr Timestamp() = default;
+
+    constexpr Timestamp(std::string_view text)
+        : seconds_{parse(text)}
+    {
+    }
+
+    constexpr Timestamp(const char* text)
+        : Timestamp{std::string_view{text}}
+    {
+    }
+
+    constexpr Timestamp(const std::string& text)
+        : Timestamp{std::string_view{text}}
+    {
+    }
+
+    constexpr bool is_valid() const
+    {
+        return seconds_ != invalid;
+    }
+
+    constexpr int64_t seconds_since_epoch() const
+    {
+        return seconds_;
+    }
+
+    constexpr auto operator<=>(const Timestamp&) const = default;
+
+private:
+    static constexpr int64_t invalid = std::numeric_limits<int64_t>::min();
+
+    int64_t seconds_ = invalid;
+
+    // reads count decimal digits at position - returns -1 when any of them is not a digit
+    static constexpr int digits(std::string_view text, size_t position, size_t count)
+    {
+        int value = 0;
+        for (size_t i = position; i < position + count; ++i)
+        {
+            if (text[i] < '0' || text[i] > '9')
+                return -1;
+            value = value * 10 + (text[i] - '0');
+        }
+
+        return value;
+    }
+
+    static constexpr bool is_leap(int year)
+    {
+        return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+    }
+
+    static constexpr int days_in_month(int year, int month)
+    {
+        constexpr int days[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+        return days[month - 1] + (month == 2 && is_leap(year));
+    }
+
+    // days since 1970/01/01 of a proleptic Gregorian date (H. Hinnant's days_from_civil)
+    static constexpr int64_t days_from_civil(int year, int month, int day)
+    {
+        year -= month <= 2;
+        const int era = year / 400;
+        const int year_of_era = year - era * 400;
+        const int day_of_year = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+        const int day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+
+        return int64_t{era} * 146097 + day_of_era - 719468;
+    }
+
+    static constexpr int64_t parse(std::string_view text)
+    {
+        // "YYYY/MM/DD " is 11 characters, time "h:MMam" or "hh:MMam" is 6 or 7
+        if (text.size() != 17 && text.size() != 18)
+            return invalid;
+
+        if (text[4] != '/' || text[7] != '/' || text[10] != ' ')
+            return invalid;
+
+        const int year = digits(text, 0, 4);
+        const int month = digits(text, 5, 2);
+        const int day = digits(text, 8, 2);
+
+        const size_t hour_digits = text.size() - 16;
+        const int hour = digits(text, 11, hour_digits);
+        const size_t time_rest = 11 + hour_digits;
+
+        if (text[time_rest] != ':')
+            return invalid;
+
+        const int minute = digits(text, time_rest + 1, 2);
+        const std::string_view meridiem = text.substr(time_rest + 3);
+
+        if (year < min_year || year > max_year || month < 1 || month > 12)
+            return invalid;
+        if (day < 1 || day > days_in_month(year, month))
+            return invalid;
+        if (hour < 1 || hour > 12 || minute < 0 || minute > 59)
+            return invalid;
+        if (meridiem != "am" && meridiem != "pm")
+            return invalid;
+
+        // 12am is midnight, 12pm is noon
+        const int hour_of_day = hour % 12 + (meridiem == "pm" ? 12 : 0);
+
+        return days_from_civil(year, month, day) * 86400 + hour_of_day * 3600 + minute * 60;
+    }
+};
+
+#endif // TIMESTAMP_HPP
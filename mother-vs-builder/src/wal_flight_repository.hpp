@@ -0,0 +1,547 @@
+#ifndef WAL_FLIGHT_REPOSITORY_HPP
+#define WAL_FLIGHT_REPOSITORY_HPP
+
+#include <array>
+#include <cerrno>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "flight_model.hpp"
+#include "flight_repository.hpp"
+
+// durable flight storage in a directory (POSIX): append-only log "flights.log" and snapshot "flights.snapshot"
+// - file: magic, version and epoch, then records: payload size, FNV-1a checksum of payload, price, flight number bytes
+// - group commit: concurrent writers queue records and one of them writes (and syncs) the whole group
+// - recovery maps snapshot and log into memory and cuts the log at the first torn or corrupted record
+// - a failed write is retried from the first byte not written; a failed sync fails the log, as written
+//   pages may already be dropped - later commits throw until a compaction rewrites all flights
+// - compaction writes all flights to a snapshot covering the current log epoch, then starts an empty log
+//   with the next epoch; a log whose epoch is covered by the snapshot is ignored, so a crash between
+//   the two steps does not duplicate flights; adds keep queueing while the snapshot is written
+class WalFlightRepository : public FlightRepository
+{
+public:
+    enum class Durability
+    {
+        buffered, // add returns when the record is queued in memory - lost with the process
+        written,  // add returns when the record is written to the OS - survives process crash
+        synced    // add returns when the record is on disk - survives power loss
+    };
+
+    struct Options
+    {
+        Durability durability = Durability::synced;
+        size_t compact_after_bytes = 64 * 1024 * 1024; // 0 - compact only on request
+    };
+
+    explicit WalFlightRepository(const std::filesystem::path& directory)
+        : WalFlightRepository(directory, Options{})
+    {
+    }
+
+    WalFlightRepository(const std::filesystem::path& directory, Options options)
+        : options_{options}, directory_{directory}, log_path_{directory / "flights.log"}, snapshot_path_{directory / "flights.snapshot"}
+    {
+        std::filesystem::create_directories(directory_);
+        recover();
+    }
+
+    WalFlightRepository(const WalFlightRepository&) = delete;
+    WalFlightRepository& operator=(const WalFlightRepository&) = delete;
+
+    ~WalFlightRepository() override
+    {
+        try
+        {
+            flush();
+        }
+        catch (...)
+        {
+        }
+
+        ::close(log_);
+    }
+
+    void add(const Flight& flight) override
+    {
+        add_all(std::span<const Flight>{&flight, 1});
+    }
+
+    // all flights are committed together
+    void add_all(std::span<const Flight> flights) override
+    {
+        uint64_t sequence = 0;
+        size_t pending_size = 0;
+        {
+            std::lock_guard lock{mutex_};
+
+            const size_t pending_before = pending_.size();
+            for (const Flight& flight : flights)
+            {
+                append_record(pending_, flight);
+                flights_.push_back(flight);
+            }
+
+            appended_bytes_ += pending_.size() - pending_before;
+            sequence = appended_bytes_;
+            pending_size = pending_.size();
+        }
+
+        switch (options_.durability)
+        {
+        case Durability::buffered:
+            if (pending_size >= buffered_limit)
+                commit(sequence, false);
+            break;
+        case Durability::written:
+            commit(sequence, false);
+            break;
+        case Durability::synced:
+            commit(sequence, true);
+            break;
+        }
+
+        if (options_.compact_after_bytes != 0)
+        {
+            // only an add which finds the log over the threshold waits for the leader - others keep committing in groups
+            std::unique_lock lock{mutex_};
+            if (log_bytes_ <= options_.compact_after_bytes)
+                return;
+
+            cv_.wait(lock, [this] { return !leader_active_; });
+
+            if (log_bytes_ > options_.compact_after_bytes)
+                compact(lock);
+        }
+    }
+
+    // writes and syncs all queued records
+    void flush()
+    {
+        uint64_t sequence = 0;
+        {
+            std::lock_guard lock{mutex_};
+            sequence = appended_bytes_;
+        }
+
+        commit(sequence, true);
+    }
+
+    // writes all flights to a new snapshot and starts an empty log - commits wait until it is done
+    void compact()
+    {
+        std::unique_lock lock{mutex_};
+        cv_.wait(lock, [this] { return !leader_active_; });
+
+        compact(lock);
+    }
+
+    std::vector<Flight> flights() const
+    {
+        std::lock_guard lock{mutex_};
+        return flights_;
+    }
+
+    size_t size() const
+    {
+        std::lock_guard lock{mutex_};
+        return flights_.size();
+    }
+
+protected:
+    // system calls - overridden by tests to inject faults
+    virtual ssize_t write_file(int file, const void* data, size_t size) const
+    {
+        return ::write(file, data, size);
+    }
+
+    virtual int sync_file(int file) const
+    {
+        return ::fdatasync(file);
+    }
+
+private:
+    static constexpr size_t buffered_limit = 64 * 1024;
+    static constexpr uint32_t version = 1;
+    static constexpr std::array<char, 4> log_magic{'F', 'W', 'A', 'L'};
+    static constexpr std::array<char, 4> snapshot_magic{'F', 'S', 'N', 'P'};
+    static constexpr size_t file_header_size = log_magic.size() + sizeof(uint32_t) + sizeof(uint64_t);
+    static constexpr size_t record_header_size = 2 * sizeof(uint32_t);
+
+    Options options_;
+    std::filesystem::path directory_;
+    std::filesystem::path log_path_;
+    std::filesystem::path snapshot_path_;
+    int log_ = -1;
+    uint64_t log_epoch_ = 0;
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<Flight> flights_;
+    std::string pending_;         // records not written to the log yet
+    uint64_t appended_bytes_ = 0; // positions in the stream of all records ever appended
+    uint64_t written_bytes_ = 0;
+    uint64_t synced_bytes_ = 0;
+    uint64_t log_bytes_ = 0;      // size of records in the current log file
+    bool leader_active_ = false;  // a group or a snapshot is being written
+    bool log_failed_ = false;
+
+    // waits until the stream is written (and synced) up to sequence - the first waiter writes for everybody
+    void commit(uint64_t sequence, bool should_sync)
+    {
+        std::unique_lock lock{mutex_};
+
+        while ((should_sync ? synced_bytes_ : written_bytes_) < sequence)
+        {
+            if (log_failed_)
+                throw std::runtime_error("cannot commit - " + log_path_.string() + " failed");
+
+            if (leader_active_)
+            {
+                cv_.wait(lock);
+                continue;
+            }
+
+            write_group(lock, should_sync);
+        }
+    }
+
+    // called with mutex_ locked and no active leader - writes queued records without holding the lock
+    void write_group(std::unique_lock<std::mutex>& lock, bool should_sync)
+    {
+        leader_active_ = true;
+
+        std::string group;
+        group.swap(pending_);
+        const uint64_t group_end = appended_bytes_;
+
+        std::string_view unwritten = group;
+
+        lock.unlock();
+        try
+        {
+            write_all(log_, unwritten);
+        }
+        catch (...)
+        {
+            // the written part stays in the log - only the rest is queued again
+            const size_t written = group.size() - unwritten.size();
+
+            lock.lock();
+            pending_.insert(0, unwritten);
+            log_bytes_ += written;
+            written_bytes_ += written;
+            leader_active_ = false;
+            cv_.notify_all();
+            throw;
+        }
+
+        try
+        {
+            if (should_sync)
+                sync(log_);
+        }
+        catch (...)
+        {
+            lock.lock();
+            log_failed_ = true;
+            log_bytes_ += group.size();
+            written_bytes_ = group_end;
+            leader_active_ = false;
+            cv_.notify_all();
+            throw;
+        }
+        lock.lock();
+
+        log_bytes_ += group.size();
+        written_bytes_ = group_end;
+        if (should_sync)
+            synced_bytes_ = group_end;
+
+        leader_active_ = false;
+        cv_.notify_all();
+    }
+
+    // called with mutex_ locked and no active leader - the snapshot is built and written without holding the lock
+    // - records queued before it started go to the snapshot instead of the log
+    void compact(std::unique_lock<std::mutex>& lock)
+    {
+        leader_active_ = true;
+
+        const std::vector<Flight> flights = flights_;
+        const uint64_t snapshot_end = appended_bytes_;
+        const uint64_t epoch = log_epoch_;
+
+        lock.unlock();
+        int log = -1;
+        bool snapshot_replaced = false;
+        try
+        {
+            std::string snapshot = file_header(snapshot_magic, epoch);
+            for (const Flight& flight : flights)
+                append_record(snapshot, flight);
+
+            replace_file(snapshot_path_, snapshot);
+            snapshot_replaced = true;
+            replace_file(log_path_, file_header(log_magic, epoch + 1));
+            log = open_file(log_path_, O_WRONLY | O_APPEND);
+        }
+        catch (...)
+        {
+            lock.lock();
+            log_failed_ = log_failed_ || snapshot_replaced; // the old log is ignored once the snapshot covers its epoch
+            leader_active_ = false;
+            cv_.notify_all();
+            throw;
+        }
+        lock.lock();
+
+        ::close(log_);
+        log_ = log;
+        log_epoch_ = epoch + 1;
+        log_bytes_ = 0;
+        log_failed_ = false;
+
+        pending_.erase(0, snapshot_end - written_bytes_);
+        written_bytes_ = synced_bytes_ = snapshot_end;
+
+        leader_active_ = false;
+        cv_.notify_all();
+    }
+
+    void recover()
+    {
+        uint64_t snapshot_epoch = 0;
+        read_file(snapshot_path_, [&](std::string_view data) {
+            snapshot_epoch = read_file_header(data, snapshot_magic, snapshot_path_);
+            return file_header_size + read_records(data.substr(file_header_size));
+        });
+
+        std::optional<uint64_t> epoch;
+        const bool has_log = read_file(log_path_, [&](std::string_view data) {
+            epoch = read_file_header(data, log_magic, log_path_);
+            if (*epoch <= snapshot_epoch)
+                return data.size(); // snapshot already holds these flights
+
+            log_bytes_ = read_records(data.substr(file_header_size));
+            return file_header_size + log_bytes_;
+        });
+
+        if (!has_log || *epoch <= snapshot_epoch)
+        {
+            epoch = snapshot_epoch + 1;
+            log_bytes_ = 0;
+            replace_file(log_path_, file_header(log_magic, *epoch));
+        }
+
+        log_epoch_ = *epoch;
+        log_ = open_file(log_path_, O_WRONLY | O_APPEND);
+    }
+
+    // maps file and passes its content to read - cuts the file to the size read returns; false when there is no file
+    template <typename Read>
+    static bool read_file(const std::filesystem::path& path, Read read)
+    {
+        const int file = ::open(path.c_str(), O_RDWR | O_CLOEXEC);
+        if (file < 0)
+        {
+            if (errno == ENOENT)
+                return false;
+            throw_errno("cannot open " + path.string());
+        }
+
+        struct stat status{};
+        void* mapping = MAP_FAILED;
+        try
+        {
+            if (::fstat(file, &status) != 0)
+                throw_errno("cannot stat " + path.string());
+
+            const auto file_size = static_cast<size_t>(status.st_size);
+            if (file_size < file_header_size)
+                throw std::runtime_error("corrupted file header " + path.string());
+
+            mapping = ::mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, file, 0);
+            if (mapping == MAP_FAILED)
+                throw_errno("cannot map " + path.string());
+
+            const size_t valid_size = read({static_cast<const char*>(mapping), file_size});
+
+            ::munmap(mapping, file_size);
+            mapping = MAP_FAILED;
+
+            if (valid_size < file_size && ::ftruncate(file, static_cast<off_t>(valid_size)) != 0)
+                throw_errno("cannot truncate " + path.string());
+        }
+        catch (...)
+        {
+            if (mapping != MAP_FAILED)
+                ::munmap(mapping, static_cast<size_t>(status.st_size));
+            ::close(file);
+            throw;
+        }
+
+        ::close(file);
+        return true;
+    }
+
+    static std::string file_header(const std::array<char, 4>& magic, uint64_t epoch)
+    {
+        std::string header(file_header_size, '\0');
+        std::memcpy(header.data(), magic.data(), magic.size());
+        std::memcpy(header.data() + magic.size(), &version, sizeof(version));
+        std::memcpy(header.data() + magic.size() + sizeof(version), &epoch, sizeof(epoch));
+
+        return header;
+    }
+
+    static uint64_t read_file_header(std::string_view data, const std::array<char, 4>& magic, const std::filesystem::path& path)
+    {
+        uint32_t file_version = 0;
+        uint64_t epoch = 0;
+        std::memcpy(&file_version, data.data() + magic.size(), sizeof(file_version));
+        std::memcpy(&epoch, data.data() + magic.size() + sizeof(file_version), sizeof(epoch));
+
+        if (data.substr(0, magic.size()) != std::string_view{magic.data(), magic.size()} || file_version != version)
+            throw std::runtime_error("corrupted file header " + path.string());
+
+        return epoch;
+    }
+
+    static uint32_t checksum(std::string_view payload)
+    {
+        uint32_t hash = 2166136261u;
+        for (char byte : payload)
+        {
+            hash ^= static_cast<unsigned char>(byte);
+            hash *= 16777619u;
+        }
+
+        return hash;
+    }
+
+    static void append_record(std::string& buffer, const Flight& flight)
+    {
+        const auto payload_size = static_cast<uint32_t>(sizeof(double) + flight.no_of_flight.size());
+        const size_t record = buffer.size();
+
+        buffer.resize(record + record_header_size + payload_size);
+        char* const data = buffer.data() + record;
+        std::memcpy(data, &payload_size, sizeof(payload_size));
+        std::memcpy(data + record_header_size, &flight.price, sizeof(double));
+        std::memcpy(data + record_header_size + sizeof(double), flight.no_of_flight.data(), flight.no_of_flight.size());
+
+        const uint32_t payload_checksum = checksum({data + record_header_size, payload_size});
+        std::memcpy(data + sizeof(payload_size), &payload_checksum, sizeof(payload_checksum));
+    }
+
+    // appends valid records to flights_ - returns size of the valid part
+    size_t read_records(std::string_view data)
+    {
+        size_t position = 0;
+
+        while (data.size() - position >= record_header_size)
+        {
+            uint32_t payload_size = 0;
+            uint32_t payload_checksum = 0;
+            std::memcpy(&payload_size, data.data() + position, sizeof(payload_size));
+            std::memcpy(&payload_checksum, data.data() + position + sizeof(payload_size), sizeof(payload_checksum));
+
+            if (payload_size < sizeof(double) || payload_size > data.size() - position - record_header_size)
+                break;
+
+            const std::string_view payload = data.substr(position + record_header_size, payload_size);
+            if (checksum(payload) != payload_checksum)
+                break;
+
+            Flight flight{std::string{payload.substr(sizeof(double))}, 0.0};
+            std::memcpy(&flight.price, payload.data(), sizeof(double));
+            flights_.push_back(std::move(flight));
+
+            position += record_header_size + payload_size;
+        }
+
+        return position;
+    }
+
+    // writes content to a temporary file and atomically renames it over path
+    void replace_file(const std::filesystem::path& path, std::string_view content) const
+    {
+        const std::filesystem::path temporary_path = path.string() + ".tmp";
+        const int temporary = open_file(temporary_path, O_WRONLY | O_CREAT | O_TRUNC);
+        try
+        {
+            write_all(temporary, content);
+            sync(temporary);
+        }
+        catch (...)
+        {
+            ::close(temporary);
+            throw;
+        }
+        ::close(temporary);
+
+        std::filesystem::rename(temporary_path, path);
+
+        const int directory = open_file(directory_, O_RDONLY | O_DIRECTORY);
+        const int result = ::fsync(directory);
+        ::close(directory);
+        if (result != 0)
+            throw_errno("cannot sync " + directory_.string());
+    }
+
+    static int open_file(const std::filesystem::path& path, int flags)
+    {
+        const int file = ::open(path.c_str(), flags | O_CLOEXEC, 0644);
+        if (file < 0)
+            throw_errno("cannot open " + path.string());
+
+        return file;
+    }
+
+    // removes written bytes from data - also when it throws
+    void write_all(int file, std::string_view& data) const
+    {
+        while (!data.empty())
+        {
+            const ssize_t written = write_file(file, data.data(), data.size());
+            if (written < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+                throw_errno("cannot write");
+            }
+
+            data.remove_prefix(static_cast<size_t>(written));
+        }
+    }
+
+    void sync(int file) const
+    {
+        if (sync_file(file) != 0)
+            throw_errno("cannot sync");
+    }
+
+    [[noreturn]] static void throw_errno(const std::string& message)
+    {
+        throw std::system_error(errno, std::generic_category(), message);
+    }
+};
+
+#endif // WAL_FLIGHT_REPOSITORY_HPP
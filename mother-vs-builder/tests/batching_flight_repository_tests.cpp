@@ -0,0 +1,176 @@
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "batching_flight_repository.hpp"
+#include "flight_service.hpp"
+#include "in_memory_flight_repository.hpp"
+
+using namespace std;
+using namespace std::chrono_literals;
+
+namespace
+{
+    Flight flight(int number)
+    {
+        return Flight{"LOT" + to_string(number), 100.0 + number};
+    }
+
+    bool is_ready(const shared_future<void>& completion)
+    {
+        return completion.wait_for(5s) == future_status::ready;
+    }
+
+    class FailingFlightRepository : public FlightRepository
+    {
+    public:
+        void add(const Flight&) override
+        {
+            throw runtime_error("storage unavailable");
+        }
+    };
+
+    class BatchRecordingFlightRepository : public InMemoryFlightRepository
+    {
+        mutable mutex mutex_;
+        vector<size_t> batch_sizes_;
+
+    public:
+        void add_all(span<const Flight> flights) override
+        {
+            {
+                lock_guard lock{mutex_};
+                batch_sizes_.push_back(flights.size());
+            }
+
+            InMemoryFlightRepository::add_all(flights);
+        }
+
+        vector<size_t> batch_sizes() const
+        {
+            lock_guard lock{mutex_};
+            return batch_sizes_;
+        }
+    };
+}
+
+class BatchingFlightRepositoryTests : public ::testing::Test
+{
+protected:
+    InMemoryFlightRepository backend_;
+};
+
+TEST_F(BatchingFlightRepositoryTests, FlushWritesQueuedFlightsInOrder)
+{
+    BatchingFlightRepository sut{backend_, {.max_batch_size = 1000, .max_delay = 1h}};
+
+    sut.add(flight(1));
+    sut.add(flight(2));
+    sut.add(flight(3));
+
+    ASSERT_TRUE(is_ready(sut.flush()));
+    EXPECT_THAT(backend_.flights(), ::testing::ElementsAre(flight(1), flight(2), flight(3)));
+}
+
+TEST_F(BatchingFlightRepositoryTests, FullBatchIsWrittenWithoutFlush)
+{
+    BatchingFlightRepository sut{backend_, {.max_batch_size = 3, .max_delay = 1h}};
+
+    sut.add(flight(1));
+    sut.add(flight(2));
+    const auto completion = sut.completion();
+    sut.add(flight(3));
+
+    ASSERT_TRUE(is_ready(completion));
+    EXPECT_EQ(backend_.flights().size(), 3u);
+}
+
+TEST_F(BatchingFlightRepositoryTests, BatchIsWrittenAfterMaxDelay)
+{
+    BatchingFlightRepository sut{backend_, {.max_batch_size = 1000, .max_delay = 10ms}};
+
+    sut.add(flight(1));
+
+    ASSERT_TRUE(is_ready(sut.completion()));
+    EXPECT_THAT(backend_.flights(), ::testing::ElementsAre(flight(1)));
+}
+
+TEST_F(BatchingFlightRepositoryTests, QueuedFlightsAreWrittenOnDestruction)
+{
+    {
+        BatchingFlightRepository sut{backend_, {.max_batch_size = 1000, .max_delay = 1h}};
+        sut.add(flight(1));
+        sut.add(flight(2));
+    }
+
+    EXPECT_EQ(backend_.flights().size(), 2u);
+}
+
+TEST_F(BatchingFlightRepositoryTests, FlushWithEmptyQueueCompletes)
+{
+    BatchingFlightRepository sut{backend_};
+
+    ASSERT_TRUE(is_ready(sut.flush()));
+    EXPECT_TRUE(backend_.flights().empty());
+}
+
+TEST_F(BatchingFlightRepositoryTests, CompletionIsReadyWhenEverythingIsWritten)
+{
+    BatchingFlightRepository sut{backend_, {.max_batch_size = 1000, .max_delay = 1h}};
+
+    EXPECT_EQ(sut.completion().wait_for(0s), future_status::ready);
+
+    sut.add(flight(1));
+    ASSERT_TRUE(is_ready(sut.flush()));
+
+    EXPECT_EQ(sut.completion().wait_for(0s), future_status::ready);
+    EXPECT_EQ(sut.flush().wait_for(0s), future_status::ready);
+}
+
+TEST(BatchingFlightRepositorySplitTests, AddAllIsSplitAtMaxBatchSize)
+{
+    BatchRecordingFlightRepository backend;
+    BatchingFlightRepository sut{backend, {.max_batch_size = 3, .max_delay = 1h}};
+
+    sut.add(flight(0));
+    sut.add_all(vector{flight(1), flight(2), flight(3), flight(4), flight(5), flight(6), flight(7)});
+
+    ASSERT_TRUE(is_ready(sut.flush()));
+    EXPECT_EQ(backend.flights().size(), 8u);
+    EXPECT_THAT(backend.batch_sizes(), ::testing::ElementsAre(3u, 3u, 2u));
+}
+
+TEST_F(BatchingFlightRepositoryTests, ZeroBatchSizeIsRejected)
+{
+    EXPECT_THROW((BatchingFlightRepository{backend_, {.max_batch_size = 0, .max_delay = 1h}}), invalid_argument);
+}
+
+TEST_F(BatchingFlightRepositoryTests, ReservationServiceWritesThroughBatches)
+{
+    BatchingFlightRepository sut{backend_, {.max_batch_size = 1000, .max_delay = 1h}};
+    FlightReservationService service{sut};
+
+    for (int number = 0; number < 100; ++number)
+        service.make_reservation(ReservationRequest{flight(number), "John Newman", "2017/01/01 1:45am"});
+
+    ASSERT_TRUE(is_ready(sut.flush()));
+    EXPECT_EQ(backend_.flights().size(), 100u);
+}
+
+TEST(BatchingFlightRepositoryFailureTests, BackendExceptionIsReportedByCompletionFuture)
+{
+    FailingFlightRepository backend;
+    BatchingFlightRepository sut{backend, {.max_batch_size = 1000, .max_delay = 1h}};
+
+    sut.add(flight(1));
+    const auto completion = sut.flush();
+
+    ASSERT_TRUE(is_ready(completion));
+    EXPECT_THROW(completion.get(), runtime_error);
+}
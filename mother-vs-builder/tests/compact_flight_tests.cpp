@@ -0,0 +1,86 @@
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "compact_flight.hpp"
+#include "string_interner.hpp"
+
+using namespace std;
+
+TEST(StringInternerTests, SameStringGetsSameDenseId)
+{
+    StringInterner sut;
+
+    EXPECT_EQ(sut.intern("LOT101"), 0u);
+    EXPECT_EQ(sut.intern("LOT202"), 1u);
+    EXPECT_EQ(sut.intern(string{"LOT101"}), 0u);
+    EXPECT_EQ(sut.size(), 2u);
+}
+
+TEST(StringInternerTests, IdMapsBackToString)
+{
+    StringInterner sut;
+    const auto id = sut.intern("John Newman");
+
+    EXPECT_EQ(sut.view(id), "John Newman");
+    EXPECT_EQ(sut.find("John Newman"), id);
+    EXPECT_EQ(sut.find("Jane Newman"), nullopt);
+    EXPECT_THROW(sut.view(id + 1), out_of_range);
+}
+
+TEST(StringInternerTests, ConcurrentInterningGivesOneIdPerString)
+{
+    StringInterner sut;
+    vector<vector<uint32_t>> ids(4);
+
+    {
+        vector<jthread> threads;
+        for (auto& thread_ids : ids)
+        {
+            threads.emplace_back([&sut, &thread_ids] {
+                for (int i = 0; i < 1000; ++i)
+                    thread_ids.push_back(sut.intern("LOT" + to_string(i)));
+            });
+        }
+    }
+
+    EXPECT_EQ(sut.size(), 1000u);
+    for (const auto& thread_ids : ids)
+        EXPECT_EQ(thread_ids, ids.front());
+}
+
+TEST(CompactFlightTests, FlightRoundTripsThroughCompactForm)
+{
+    StringInterner flight_numbers;
+    const Flight flight{"LOT101", 100.25};
+
+    const CompactFlight compact = to_compact(flight, flight_numbers);
+
+    EXPECT_EQ(compact, (CompactFlight{0, 10025}));
+    EXPECT_EQ(to_flight(compact, flight_numbers), flight);
+}
+
+TEST(CompactFlightTests, PriceIsRoundedToHundredths)
+{
+    EXPECT_EQ(to_price_cents(0.125), 13);
+    EXPECT_EQ(to_price_cents(99.994), 9999);
+    EXPECT_THROW(to_price_cents(1e10), out_of_range);
+}
+
+TEST(CompactFlightTests, ReservationRequestRoundTripsThroughCompactForm)
+{
+    StringInterner flight_numbers;
+    StringInterner clients;
+    const ReservationRequest request{Flight{"LOT101", 100.0}, "John Newman", "2017/01/01 1:45am"};
+
+    const CompactReservationRequest compact = to_compact(request, flight_numbers, clients);
+    const ReservationRequest restored = to_reservation_request(compact, flight_numbers, clients);
+
+    EXPECT_EQ(compact.client_id, 0u);
+    EXPECT_EQ(restored.flight, request.flight);
+    EXPECT_EQ(restored.client, request.client);
+    EXPECT_EQ(restored.timestamp, request.timestamp);
+}
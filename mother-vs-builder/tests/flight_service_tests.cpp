@@ -1,6 +1,8 @@
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include <memory>
+#include <span>
+#include <vector>
 
 #include "flight_model.hpp"
 #include "flight_repository.hpp"
@@ -102,4 +104,59 @@ TEST_F(FlightServiceTests, ThrowsWhenClientIsEmptyString)
     auto reservation_request = reservation_request_builder.get_reservation_request();
 
     EXPECT_THROW(sut_.make_reservation(reservation_request), std::invalid_argument);
-}
\ No newline at end of file
+}
+class MockBulkFlightRepository : public FlightRepository
+{
+public:
+    MOCK_METHOD(void, add, (const Flight&), (override));
+    MOCK_METHOD(void, add_all, (std::span<const Flight>), (override));
+};
+
+TEST_F(FlightServiceTests, BulkReservationReturnsStatusPerRequest)
+{
+    const vector<ReservationRequest> reservation_requests{
+        Mother::create_reservation_request(),
+        ReservationRequestBuilder{}.with_timestamp("2017|01|01 1:45am").get_reservation_request(),
+        ReservationRequestBuilder{}.with_client("").get_reservation_request(),
+        ReservationRequestBuilder{}.with_client("").with_timestamp("").get_reservation_request()};
+
+    EXPECT_CALL(flight_repository_, add(reservation_requests[0].flight)).Times(1);
+
+    const auto statuses = sut_.make_reservations(reservation_requests);
+
+    EXPECT_THAT(statuses, ::testing::ElementsAre(ReservationStatus::accepted, ReservationStatus::invalid_timestamp,
+                                                 ReservationStatus::invalid_client, ReservationStatus::invalid_timestamp));
+}
+
+TEST(FlightServiceBulkTests, AcceptedFlightsAreAddedInOneBulkCall)
+{
+    MockBulkFlightRepository flight_repository;
+    FlightReservationService sut{flight_repository};
+
+    const vector<ReservationRequest> reservation_requests{
+        ReservationRequestBuilder{}.with_flight(Flight{"LOT101", 100.0}).get_reservation_request(),
+        ReservationRequestBuilder{}.with_client("").get_reservation_request(),
+        ReservationRequestBuilder{}.with_flight(Flight{"LOT202", 200.0}).get_reservation_request()};
+
+    vector<Flight> added_flights;
+    EXPECT_CALL(flight_repository, add(::testing::_)).Times(0);
+    EXPECT_CALL(flight_repository, add_all(::testing::_)).WillOnce([&](std::span<const Flight> flights) {
+        added_flights.assign(flights.begin(), flights.end());
+    });
+
+    sut.make_reservations(reservation_requests);
+
+    EXPECT_THAT(added_flights, ::testing::ElementsAre(Flight{"LOT101", 100.0}, Flight{"LOT202", 200.0}));
+}
+
+TEST(FlightServiceBulkTests, RepositoryIsNotCalledWhenAllRequestsAreRejected)
+{
+    MockBulkFlightRepository flight_repository;
+    FlightReservationService sut{flight_repository};
+
+    const vector<ReservationRequest> reservation_requests{ReservationRequestBuilder{}.with_client("").get_reservation_request()};
+
+    EXPECT_CALL(flight_repository, add_all(::testing::_)).Times(0);
+
+    EXPECT_THAT(sut.make_reservations(reservation_requests), ::testing::ElementsAre(ReservationStatus::invalid_client));
+}
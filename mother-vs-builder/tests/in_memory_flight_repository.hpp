@@ -0,0 +1,37 @@
+#ifndef IN_MEMORY_FLIGHT_REPOSITORY_HPP
+#define IN_MEMORY_FLIGHT_REPOSITORY_HPP
+
+#include <mutex>
+#include <span>
+#include <vector>
+
+#include "flight_model.hpp"
+#include "flight_repository.hpp"
+
+// thread-safe stand-in for real storage - keeps added flights in order
+class InMemoryFlightRepository : public FlightRepository
+{
+    mutable std::mutex mutex_;
+    std::vector<Flight> flights_;
+
+public:
+    void add(const Flight& flight) override
+    {
+        std::lock_guard lock{mutex_};
+        flights_.push_back(flight);
+    }
+
+    void add_all(std::span<const Flight> flights) override
+    {
+        std::lock_guard lock{mutex_};
+        flights_.insert(flights_.end(), flights.begin(), flights.end());
+    }
+
+    std::vector<Flight> flights() const
+    {
+        std::lock_guard lock{mutex_};
+        return flights_;
+    }
+};
+
+#endif // IN_MEMORY_FLIGHT_REPOSITORY_HPP
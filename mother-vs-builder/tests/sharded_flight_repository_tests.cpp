@@ -0,0 +1,58 @@
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "sharded_flight_repository.hpp"
+
+using namespace std;
+using ::testing::ElementsAre;
+using ::testing::IsEmpty;
+
+class ShardedFlightRepositoryTests : public ::testing::Test
+{
+protected:
+    ShardedFlightRepository sut_{8};
+};
+
+TEST_F(ShardedFlightRepositoryTests, FindsFlightsByNumber)
+{
+    sut_.add(Flight{"LOT101", 100.0});
+    sut_.add(Flight{"LOT202", 200.0});
+    sut_.add(Flight{"LOT101", 150.0});
+
+    EXPECT_THAT(sut_.find_by_number("LOT101"), ElementsAre(Flight{"LOT101", 100.0}, Flight{"LOT101", 150.0}));
+    EXPECT_THAT(sut_.find_by_number("LOT303"), IsEmpty());
+    EXPECT_EQ(sut_.size(), 3u);
+}
+
+TEST_F(ShardedFlightRepositoryTests, FindsFlightsInPriceRangeOrderedByPrice)
+{
+    const vector<Flight> flights{{"LOT1", 300.0}, {"LOT2", 100.0}, {"LOT3", 250.0}, {"LOT4", 50.0}, {"LOT5", 200.0}};
+    sut_.add_all(flights);
+
+    EXPECT_THAT(sut_.find_by_price(100.0, 250.0), ElementsAre(Flight{"LOT2", 100.0}, Flight{"LOT5", 200.0}, Flight{"LOT3", 250.0}));
+    EXPECT_THAT(sut_.find_by_price(400.0, 500.0), IsEmpty());
+}
+
+TEST_F(ShardedFlightRepositoryTests, ConcurrentAddsAreAllStored)
+{
+    constexpr int threads_count = 8;
+    constexpr int flights_per_thread = 1000;
+
+    {
+        vector<jthread> threads;
+        for (int t = 0; t < threads_count; ++t)
+        {
+            threads.emplace_back([this, t] {
+                for (int i = 0; i < flights_per_thread; ++i)
+                    sut_.add(Flight{"LOT" + to_string(i % 100), static_cast<double>(t * flights_per_thread + i)});
+            });
+        }
+    }
+
+    EXPECT_EQ(sut_.size(), static_cast<size_t>(threads_count * flights_per_thread));
+    EXPECT_EQ(sut_.find_by_number("LOT7").size(), static_cast<size_t>(threads_count * flights_per_thread / 100));
+    EXPECT_EQ(sut_.find_by_price(0.0, 999.0).size(), 1000u);
+}
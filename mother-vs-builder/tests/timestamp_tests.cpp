@@ -0,0 +1,63 @@
+#include "gtest/gtest.h"
+#include <string>
+
+#include "timestamp.hpp"
+
+using namespace std;
+
+static_assert(Timestamp{"1970/01/01 12:00am"}.seconds_since_epoch() == 0);
+static_assert(Timestamp{"2017/01/01 1:45am"} < Timestamp{"2017/01/01 1:45pm"});
+static_assert(!Timestamp{"2017|01|01 1:45am"}.is_valid());
+static_assert(!Timestamp{}.is_valid());
+
+TEST(TimestampTests, ParsesDateAndTimeToSecondsSinceEpoch)
+{
+    EXPECT_EQ(Timestamp{"2017/01/01 1:45am"}.seconds_since_epoch(), 1483235100);
+    EXPECT_EQ(Timestamp{"2017/01/01 1:45pm"}.seconds_since_epoch(), 1483235100 + 12 * 3600);
+    EXPECT_EQ(Timestamp{"2000/02/29 11:59pm"}.seconds_since_epoch(), 951868740);
+}
+
+TEST(TimestampTests, TwelveAmIsMidnightAndTwelvePmIsNoon)
+{
+    EXPECT_EQ(Timestamp{"1970/01/02 12:00am"}.seconds_since_epoch(), 86400);
+    EXPECT_EQ(Timestamp{"1970/01/02 12:00pm"}.seconds_since_epoch(), 86400 + 12 * 3600);
+}
+
+TEST(TimestampTests, IsConstructibleFromStrings)
+{
+    const string text = "2017/01/01 1:45am";
+    Timestamp timestamp;
+
+    timestamp = text;
+
+    EXPECT_EQ(timestamp, Timestamp{"2017/01/01 1:45am"});
+}
+
+struct InvalidTimestampTests : ::testing::TestWithParam<const char*>
+{
+};
+
+TEST_P(InvalidTimestampTests, TimestampIsInvalid)
+{
+    EXPECT_FALSE(Timestamp{GetParam()}.is_valid());
+}
+
+const char* invalid_timestamps[] = {
+    "",
+    "2017|01|01 1:45am",
+    "2017/01/01 1:45",
+    "2017/01/01 1:45xm",
+    "2017/01/01 1:45am ",
+    "2017/1/01 1:45am",
+    "2017/13/01 1:45am",
+    "2017/00/01 1:45am",
+    "2017/02/29 1:45am",
+    "2017/04/31 1:45am",
+    "2017/01/01 0:45am",
+    "2017/01/01 13:45am",
+    "2017/01/01 1:60am",
+    "1969/12/31 11:59pm",
+    "20a7/01/01 1:45am",
+};
+
+INSTANTIATE_TEST_SUITE_P(PackOfInvalidTimestamps, InvalidTimestampTests, ::testing::ValuesIn(invalid_timestamps));
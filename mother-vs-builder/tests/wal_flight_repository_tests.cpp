@@ -0,0 +1,314 @@
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include <cerrno>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "wal_flight_repository.hpp"
+
+using namespace std;
+using ::testing::ElementsAre;
+using ::testing::IsEmpty;
+using ::testing::UnorderedElementsAreArray;
+
+namespace
+{
+    class FaultyWalFlightRepository : public WalFlightRepository
+    {
+    public:
+        using WalFlightRepository::WalFlightRepository;
+
+        mutable bool tear_next_write = false; // next write stores half of its data, the one after it fails
+        mutable bool fail_next_write = false;
+        mutable bool fail_next_sync = false;
+
+    protected:
+        ssize_t write_file(int file, const void* data, size_t size) const override
+        {
+            if (tear_next_write)
+            {
+                tear_next_write = false;
+                fail_next_write = true;
+                return WalFlightRepository::write_file(file, data, size / 2);
+            }
+
+            if (fail_next_write)
+            {
+                fail_next_write = false;
+                errno = EIO;
+                return -1;
+            }
+
+            return WalFlightRepository::write_file(file, data, size);
+        }
+
+        int sync_file(int file) const override
+        {
+            if (fail_next_sync)
+            {
+                fail_next_sync = false;
+                errno = EIO;
+                return -1;
+            }
+
+            return WalFlightRepository::sync_file(file);
+        }
+    };
+}
+
+class WalFlightRepositoryTests : public ::testing::Test
+{
+protected:
+    filesystem::path directory_ = filesystem::temp_directory_path() /
+        ("wal_flight_repository_tests_" + to_string(::getpid()) + "_" + ::testing::UnitTest::GetInstance()->current_test_info()->name());
+
+    void SetUp() override
+    {
+        filesystem::remove_all(directory_);
+    }
+
+    void TearDown() override
+    {
+        filesystem::remove_all(directory_);
+    }
+
+    void append_to_log(const string& bytes)
+    {
+        ofstream log{directory_ / "flights.log", ios::binary | ios::app};
+        log << bytes;
+    }
+};
+
+TEST_F(WalFlightRepositoryTests, FlightsAreRestoredAfterReopen)
+{
+    {
+        WalFlightRepository sut{directory_};
+        sut.add(Flight{"LOT101", 100.0});
+        sut.add(Flight{"LOT202", 200.5});
+    }
+
+    WalFlightRepository sut{directory_};
+
+    EXPECT_THAT(sut.flights(), ElementsAre(Flight{"LOT101", 100.0}, Flight{"LOT202", 200.5}));
+}
+
+TEST_F(WalFlightRepositoryTests, BufferedFlightsAreWrittenOnFlush)
+{
+    WalFlightRepository sut{directory_, {.durability = WalFlightRepository::Durability::buffered}};
+    const vector<Flight> flights{{"LOT1", 10.0}, {"LOT2", 20.0}, {"LOT3", 30.0}};
+    sut.add_all(flights);
+
+    const auto log_size_before_flush = filesystem::file_size(directory_ / "flights.log");
+    sut.flush();
+
+    EXPECT_GT(filesystem::file_size(directory_ / "flights.log"), log_size_before_flush);
+    EXPECT_EQ(WalFlightRepository{directory_}.flights(), flights);
+}
+
+TEST_F(WalFlightRepositoryTests, TornRecordAtEndOfLogIsDiscarded)
+{
+    {
+        WalFlightRepository sut{directory_};
+        sut.add(Flight{"LOT101", 100.0});
+    }
+    const auto valid_log_size = filesystem::file_size(directory_ / "flights.log");
+    append_to_log(string{"\x20\x00\x00\x00\x01\x02", 6});
+
+    {
+        WalFlightRepository sut{directory_};
+
+        EXPECT_THAT(sut.flights(), ElementsAre(Flight{"LOT101", 100.0}));
+        EXPECT_EQ(filesystem::file_size(directory_ / "flights.log"), valid_log_size);
+
+        sut.add(Flight{"LOT202", 200.0});
+    }
+
+    EXPECT_THAT(WalFlightRepository{directory_}.flights(), ElementsAre(Flight{"LOT101", 100.0}, Flight{"LOT202", 200.0}));
+}
+
+TEST_F(WalFlightRepositoryTests, RecordWithWrongChecksumEndsRecovery)
+{
+    {
+        WalFlightRepository sut{directory_};
+        sut.add(Flight{"LOT101", 100.0});
+        sut.add(Flight{"LOT202", 200.0});
+    }
+
+    {
+        fstream log{directory_ / "flights.log", ios::binary | ios::in | ios::out};
+        log.seekp(-1, ios::end);
+        log.put('X');
+    }
+
+    EXPECT_THAT(WalFlightRepository{directory_}.flights(), ElementsAre(Flight{"LOT101", 100.0}));
+}
+
+TEST_F(WalFlightRepositoryTests, CompactionMovesFlightsToSnapshot)
+{
+    {
+        WalFlightRepository sut{directory_};
+        sut.add(Flight{"LOT101", 100.0});
+        sut.add(Flight{"LOT202", 200.0});
+
+        const auto log_size_before_compaction = filesystem::file_size(directory_ / "flights.log");
+        sut.compact();
+
+        EXPECT_LT(filesystem::file_size(directory_ / "flights.log"), log_size_before_compaction);
+        EXPECT_TRUE(filesystem::exists(directory_ / "flights.snapshot"));
+
+        sut.add(Flight{"LOT303", 300.0});
+    }
+
+    EXPECT_THAT(WalFlightRepository{directory_}.flights(),
+        ElementsAre(Flight{"LOT101", 100.0}, Flight{"LOT202", 200.0}, Flight{"LOT303", 300.0}));
+}
+
+TEST_F(WalFlightRepositoryTests, LogCoveredBySnapshotIsIgnored)
+{
+    {
+        WalFlightRepository sut{directory_};
+        sut.add(Flight{"LOT101", 100.0});
+    }
+    const filesystem::path old_log = directory_ / "old.log";
+    filesystem::copy_file(directory_ / "flights.log", old_log);
+
+    {
+        WalFlightRepository sut{directory_};
+        sut.compact();
+    }
+    // crash after the snapshot was written but before the log was replaced
+    filesystem::rename(old_log, directory_ / "flights.log");
+
+    EXPECT_THAT(WalFlightRepository{directory_}.flights(), ElementsAre(Flight{"LOT101", 100.0}));
+}
+
+TEST_F(WalFlightRepositoryTests, LogIsCompactedAfterThreshold)
+{
+    {
+        WalFlightRepository sut{directory_, {.compact_after_bytes = 256}};
+        for (int i = 0; i < 100; ++i)
+            sut.add(Flight{"LOT" + to_string(i), static_cast<double>(i)});
+
+        EXPECT_LE(filesystem::file_size(directory_ / "flights.log"), 512u);
+    }
+
+    EXPECT_EQ(WalFlightRepository{directory_}.size(), 100u);
+}
+
+TEST_F(WalFlightRepositoryTests, ConcurrentAddsDuringCompactionAreAllStored)
+{
+    constexpr int threads_count = 4;
+    constexpr int flights_per_thread = 200;
+    vector<Flight> expected;
+
+    {
+        WalFlightRepository sut{directory_, {.durability = WalFlightRepository::Durability::written, .compact_after_bytes = 256}};
+        {
+            vector<jthread> threads;
+            for (int t = 0; t < threads_count; ++t)
+            {
+                threads.emplace_back([&sut, t] {
+                    for (int i = 0; i < flights_per_thread; ++i)
+                        sut.add(Flight{"LOT" + to_string(t), static_cast<double>(i)});
+                });
+            }
+        }
+
+        expected = sut.flights();
+    }
+
+    EXPECT_EQ(expected.size(), static_cast<size_t>(threads_count * flights_per_thread));
+    EXPECT_EQ(WalFlightRepository{directory_}.flights(), expected);
+}
+
+TEST_F(WalFlightRepositoryTests, FailedWriteIsRetriedFromFirstUnwrittenByte)
+{
+    {
+        FaultyWalFlightRepository sut{directory_};
+        sut.add(Flight{"LOT101", 100.0});
+
+        sut.tear_next_write = true;
+        EXPECT_THROW(sut.add(Flight{"LOT202", 200.0}), system_error);
+
+        sut.add(Flight{"LOT303", 300.0});
+    }
+
+    EXPECT_THAT(WalFlightRepository{directory_}.flights(),
+                ElementsAre(Flight{"LOT101", 100.0}, Flight{"LOT202", 200.0}, Flight{"LOT303", 300.0}));
+}
+
+TEST_F(WalFlightRepositoryTests, FailedSyncFailsLogWithoutWritingRecordsAgain)
+{
+    {
+        FaultyWalFlightRepository sut{directory_};
+        sut.add(Flight{"LOT101", 100.0});
+
+        sut.fail_next_sync = true;
+        EXPECT_THROW(sut.add(Flight{"LOT202", 200.0}), system_error);
+        EXPECT_THROW(sut.add(Flight{"LOT303", 300.0}), runtime_error);
+        EXPECT_THROW(sut.flush(), runtime_error);
+    }
+
+    EXPECT_THAT(WalFlightRepository{directory_}.flights(), ElementsAre(Flight{"LOT101", 100.0}, Flight{"LOT202", 200.0}));
+}
+
+TEST_F(WalFlightRepositoryTests, CompactionRecoversFailedLog)
+{
+    {
+        FaultyWalFlightRepository sut{directory_};
+        sut.add(Flight{"LOT101", 100.0});
+
+        sut.fail_next_sync = true;
+        EXPECT_THROW(sut.add(Flight{"LOT202", 200.0}), system_error);
+
+        sut.compact();
+        sut.add(Flight{"LOT303", 300.0});
+    }
+
+    EXPECT_THAT(WalFlightRepository{directory_}.flights(),
+                ElementsAre(Flight{"LOT101", 100.0}, Flight{"LOT202", 200.0}, Flight{"LOT303", 300.0}));
+}
+
+TEST_F(WalFlightRepositoryTests, ConcurrentSyncedAddsAreAllStored)
+{
+    constexpr int threads_count = 8;
+    constexpr int flights_per_thread = 50;
+    vector<Flight> expected;
+
+    {
+        WalFlightRepository sut{directory_};
+        {
+            vector<jthread> threads;
+            for (int t = 0; t < threads_count; ++t)
+            {
+                threads.emplace_back([&sut, t] {
+                    for (int i = 0; i < flights_per_thread; ++i)
+                        sut.add(Flight{"LOT" + to_string(t), static_cast<double>(i)});
+                });
+            }
+        }
+
+        expected = sut.flights();
+    }
+
+    EXPECT_EQ(expected.size(), static_cast<size_t>(threads_count * flights_per_thread));
+    EXPECT_THAT(WalFlightRepository{directory_}.flights(), UnorderedElementsAreArray(expected));
+}
+
+TEST_F(WalFlightRepositoryTests, CorruptedFileHeaderThrows)
+{
+    filesystem::create_directories(directory_);
+    append_to_log("not a log file");
+
+    EXPECT_THROW(WalFlightRepository{directory_}, runtime_error);
+}
+
+TEST_F(WalFlightRepositoryTests, EmptyRepositoryHasNoFlights)
+{
+    EXPECT_THAT(WalFlightRepository{directory_}.flights(), IsEmpty());
+}
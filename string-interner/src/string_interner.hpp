@@ -0,0 +1,81 @@
+#ifndef STRING_INTERNER_HPP
+#define STRING_INTERNER_HPP
+
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+// stores every distinct string once and maps it to a dense 32-bit id (0, 1, 2, ... in order of interning)
+// - ids and views stay valid for the lifetime of the interner
+// - thread-safe: known strings are looked up under a shared lock
+class StringInterner
+{
+    mutable std::shared_mutex mutex_;
+    std::deque<std::string> strings_; // deque never moves elements, so keys of ids_ stay valid
+    std::unordered_map<std::string_view, uint32_t> ids_;
+
+public:
+    void reserve(size_t count)
+    {
+        std::unique_lock lock{mutex_};
+        ids_.reserve(count);
+    }
+
+    uint32_t intern(std::string_view text)
+    {
+        if (auto id = find(text))
+            return *id;
+
+        std::unique_lock lock{mutex_};
+
+        if (auto found = ids_.find(text); found != ids_.end())
+            return found->second;
+
+        if (strings_.size() == std::numeric_limits<uint32_t>::max())
+            throw std::length_error("too many interned strings");
+
+        const auto id = static_cast<uint32_t>(strings_.size());
+        const std::string& stored = strings_.emplace_back(text);
+        ids_.emplace(stored, id);
+
+        return id;
+    }
+
+    std::optional<uint32_t> find(std::string_view text) const
+    {
+        std::shared_lock lock{mutex_};
+
+        if (auto found = ids_.find(text); found != ids_.end())
+            return found->second;
+
+        return std::nullopt;
+    }
+
+    // throws out_of_range for unknown id
+    std::string_view view(uint32_t id) const
+    {
+        return text(id);
+    }
+
+    // throws out_of_range for unknown id
+    const std::string& text(uint32_t id) const
+    {
+        std::shared_lock lock{mutex_};
+        return strings_.at(id);
+    }
+
+    size_t size() const
+    {
+        std::shared_lock lock{mutex_};
+        return strings_.size();
+    }
+};
+
+#endif // STRING_INTERNER_HPP
@@ -0,0 +1,105 @@
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+
+#include "bowling_notation.hpp"
+
+using namespace std;
+
+// Usage: notation_benchmark [games_file]
+// - without a file one million random games are generated in memory
+
+namespace
+{
+    char ball_symbol(int pins, int first_in_rack)
+    {
+        if (first_in_rack == TDD::Notation::NO_BALL && pins == 10)
+            return TDD::Notation::STRIKE;
+        if (first_in_rack != TDD::Notation::NO_BALL && first_in_rack + pins == 10)
+            return TDD::Notation::SPARE;
+        return pins == 0 ? TDD::Notation::GUTTER : static_cast<char>('0' + pins);
+    }
+
+    string random_frame(mt19937& rnd, bool is_last_frame)
+    {
+        string frame;
+        int first_in_rack = TDD::Notation::NO_BALL;
+        int max_balls = 2;
+
+        for (int ball = 0; ball < max_balls; ++ball)
+        {
+            const int standing = first_in_rack == TDD::Notation::NO_BALL ? 10 : 10 - first_in_rack;
+            const int pins = uniform_int_distribution<int>(0, standing)(rnd);
+            const char symbol = ball_symbol(pins, first_in_rack);
+            frame += symbol;
+
+            const bool rack_cleared = symbol == TDD::Notation::STRIKE || symbol == TDD::Notation::SPARE;
+            if (!is_last_frame && symbol == TDD::Notation::STRIKE)
+                break;
+            if (is_last_frame && ball < 2 && rack_cleared)
+                max_balls = 3;
+
+            first_in_rack = (first_in_rack == TDD::Notation::NO_BALL && !rack_cleared) ? pins : TDD::Notation::NO_BALL;
+        }
+
+        return frame;
+    }
+
+    string random_games(size_t count)
+    {
+        mt19937 rnd{42};
+        string games;
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            for (int frame = 1; frame <= 10; ++frame)
+            {
+                games += random_frame(rnd, frame == 10);
+                games += frame == 10 ? '\n' : ' ';
+            }
+        }
+
+        return games;
+    }
+
+    void run(istream& input, size_t input_size)
+    {
+        long long total_score = 0;
+
+        const auto start = chrono::steady_clock::now();
+        const size_t count = TDD::for_each_game(input, [&](const TDD::BowlingGame& game) { total_score += game.score(); });
+        const chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+        cout << "games:         " << count << "\n";
+        cout << "total score:   " << total_score << "\n";
+        cout << "elapsed:       " << elapsed.count() << " s\n";
+        cout << "lines/s:       " << static_cast<double>(count) / elapsed.count() << "\n";
+        if (input_size)
+            cout << "MB/s:          " << static_cast<double>(input_size) / (1024 * 1024) / elapsed.count() << "\n";
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc > 1)
+    {
+        ifstream file(argv[1], ios::binary);
+        if (!file)
+        {
+            cerr << "Cannot open " << argv[1] << "\n";
+            return 1;
+        }
+
+        run(file, 0);
+        return 0;
+    }
+
+    const string games = random_games(1'000'000);
+    istringstream input(games);
+    run(input, games.size());
+
+    return 0;
+}
@@ -1,14 +1,108 @@
 #ifndef BOWLING_HPP
 #define BOWLING_HPP
 
-#include <vector>
-#include <string>
-#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
 
 namespace TDD
 {
-    class BowlingGame   
-    {};
+    class BowlingGame
+    {
+    public:
+        static constexpr int MAX_PINS_IN_FRAME = 10;
+        static constexpr int MAX_FRAMES_COUNT = 10;
+        static constexpr size_t MAX_ROLLS_IN_GAME = 21;
+
+        constexpr void roll(int pins)
+        {
+            if (pins < 0 || pins > MAX_PINS_IN_FRAME)
+                throw std::invalid_argument("invalid number of pins");
+
+            if (roll_count_ == MAX_ROLLS_IN_GAME)
+                throw std::out_of_range("too many rolls in game");
+
+            if (first_in_rack_ != NO_BALL && first_in_rack_ + pins > MAX_PINS_IN_FRAME)
+                throw std::invalid_argument("too many pins in frame");
+
+            pins_[roll_count_] = pins;
+            ++roll_count_;
+
+            // rack is set up again after a strike or a second ball - also for bonus balls of the tenth frame
+            first_in_rack_ = (first_in_rack_ == NO_BALL && pins != MAX_PINS_IN_FRAME) ? pins : NO_BALL;
+        }
+
+        constexpr int score() const
+        {
+            int result = 0;
+
+            for (size_t frame_index = 0, roll_index = 0; frame_index < MAX_FRAMES_COUNT; ++frame_index)
+            {
+                if (is_strike(roll_index))
+                {
+                    result += MAX_PINS_IN_FRAME + strike_bonus(roll_index);
+                    roll_index += 1;
+                }
+                else if (is_spare(roll_index))
+                {
+                    result += MAX_PINS_IN_FRAME + spare_bonus(roll_index);
+                    roll_index += 2;
+                }
+                else
+                {
+                    result += pins_[roll_index] + pins_[roll_index + 1];
+                    roll_index += 2;
+                }
+            }
+
+            return result;
+        }
+
+        constexpr size_t roll_count() const
+        {
+            return roll_count_;
+        }
+
+    private:
+        static constexpr int NO_BALL = -1;
+
+        std::array<int, MAX_ROLLS_IN_GAME> pins_{};
+        size_t roll_count_{};
+        int first_in_rack_ = NO_BALL; // pins of the first ball thrown at the current rack
+
+        constexpr bool is_strike(size_t roll_index) const
+        {
+            return pins_[roll_index] == MAX_PINS_IN_FRAME;
+        }
+
+        constexpr bool is_spare(size_t roll_index) const
+        {
+            return pins_[roll_index] + pins_[roll_index + 1] == MAX_PINS_IN_FRAME;
+        }
+
+        constexpr int strike_bonus(size_t roll_index) const
+        {
+            return pins_[roll_index + 1] + pins_[roll_index + 2];
+        }
+
+        constexpr int spare_bonus(size_t roll_index) const
+        {
+            return pins_[roll_index + 2];
+        }
+    };
+
+    // scores a complete sequence of rolls - usable in constant expressions:
+    // static_assert(TDD::score(std::array{10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10}) == 300);
+    constexpr int score(std::span<const int> rolls)
+    {
+        BowlingGame game;
+
+        for (int pins : rolls)
+            game.roll(pins);
+
+        return game.score();
+    }
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,173 @@
+#ifndef BOWLING_NOTATION_HPP
+#define BOWLING_NOTATION_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <istream>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+#include "bowling.hpp"
+
+namespace TDD
+{
+    class InvalidNotationException : public std::invalid_argument
+    {
+    public:
+        explicit InvalidNotationException(const char* reason) : std::invalid_argument(reason) {}
+    };
+
+    namespace Notation
+    {
+        constexpr char STRIKE = 'X';
+        constexpr char SPARE = '/';
+        constexpr char GUTTER = '-';
+        constexpr int NO_BALL = -1;
+
+        // returns number of pins for a ball written as symbol,
+        // first_in_rack is the first ball thrown at the current rack of pins (or NO_BALL)
+        constexpr int ball_pins(char symbol, int first_in_rack)
+        {
+            switch (symbol)
+            {
+            case STRIKE:
+                if (first_in_rack != NO_BALL)
+                    throw InvalidNotationException("strike must be the first ball of a rack");
+                return BowlingGame::MAX_PINS_IN_FRAME;
+            case SPARE:
+                if (first_in_rack == NO_BALL)
+                    throw InvalidNotationException("spare must be the second ball of a rack");
+                return BowlingGame::MAX_PINS_IN_FRAME - first_in_rack;
+            case GUTTER:
+                return 0;
+            default:
+                if (symbol < '1' || symbol > '9')
+                    throw InvalidNotationException("unknown ball symbol");
+
+                const int pins = symbol - '0';
+                if (first_in_rack != NO_BALL && first_in_rack + pins >= BowlingGame::MAX_PINS_IN_FRAME)
+                    throw InvalidNotationException("cleared rack must be written as spare");
+                return pins;
+            }
+        }
+
+        constexpr void parse_frame(std::string_view frame, bool is_last_frame, BowlingGame& game)
+        {
+            if (frame.size() > (is_last_frame ? 3u : 2u))
+                throw InvalidNotationException("too many balls in frame");
+
+            int first_in_rack = NO_BALL;
+            bool has_bonus_balls = false;
+
+            for (size_t ball = 0; ball < frame.size(); ++ball)
+            {
+                const char symbol = frame[ball];
+                const int pins = ball_pins(symbol, first_in_rack);
+                game.roll(pins);
+
+                const bool rack_cleared = symbol == STRIKE || symbol == SPARE;
+                first_in_rack = (first_in_rack == NO_BALL && !rack_cleared) ? pins : NO_BALL;
+
+                if (ball < 2 && rack_cleared)
+                    has_bonus_balls = true;
+            }
+
+            size_t expected_balls = 2;
+            if (!is_last_frame && frame.front() == STRIKE)
+                expected_balls = 1;
+            else if (is_last_frame && has_bonus_balls)
+                expected_balls = 3;
+
+            if (frame.size() != expected_balls)
+                throw InvalidNotationException("wrong number of balls in frame");
+        }
+
+        constexpr bool is_separator(char c)
+        {
+            return c == ' ' || c == '\t' || c == '\r';
+        }
+    }
+
+    // parses a whole game written in standard notation, e.g. "X 7/ 9- X -8 8/ -6 X X X81"
+    // - frames are separated by whitespace, the tenth frame is a single token with its bonus balls
+    constexpr BowlingGame parse_game(std::string_view line)
+    {
+        BowlingGame game;
+        int frame_index = 0;
+        size_t pos = 0;
+
+        while (true)
+        {
+            while (pos < line.size() && Notation::is_separator(line[pos]))
+                ++pos;
+
+            if (pos == line.size())
+                break;
+
+            size_t frame_end = pos;
+            while (frame_end < line.size() && !Notation::is_separator(line[frame_end]))
+                ++frame_end;
+
+            if (frame_index == BowlingGame::MAX_FRAMES_COUNT)
+                throw InvalidNotationException("too many frames in game");
+
+            ++frame_index;
+            Notation::parse_frame(line.substr(pos, frame_end - pos), frame_index == BowlingGame::MAX_FRAMES_COUNT, game);
+            pos = frame_end;
+        }
+
+        if (frame_index != BowlingGame::MAX_FRAMES_COUNT)
+            throw InvalidNotationException("incomplete game");
+
+        return game;
+    }
+
+    // reads newline separated games from input in chunks of chunk_size bytes and calls on_game(const BowlingGame&)
+    // for every game - lines are parsed in place from the chunk buffer; returns number of parsed games
+    template <typename OnGame>
+    size_t for_each_game(std::istream& input, OnGame&& on_game, size_t chunk_size = 1 << 20)
+    {
+        std::vector<char> buffer(std::max<size_t>(chunk_size, 1));
+        size_t carried = 0;
+        size_t games_count = 0;
+
+        auto parse_line = [&](std::string_view line) {
+            if (std::all_of(line.begin(), line.end(), Notation::is_separator))
+                return;
+
+            on_game(parse_game(line));
+            ++games_count;
+        };
+
+        while (true)
+        {
+            if (carried == buffer.size()) // line longer than chunk
+                buffer.resize(buffer.size() * 2);
+
+            input.read(buffer.data() + carried, static_cast<std::streamsize>(buffer.size() - carried));
+            const std::string_view data(buffer.data(), carried + static_cast<size_t>(input.gcount()));
+
+            size_t line_start = 0;
+            for (size_t line_end = data.find('\n'); line_end != std::string_view::npos; line_end = data.find('\n', line_start))
+            {
+                parse_line(data.substr(line_start, line_end - line_start));
+                line_start = line_end + 1;
+            }
+
+            carried = data.size() - line_start;
+            if (line_start != 0)
+                std::copy(data.begin() + line_start, data.end(), buffer.begin());
+
+            if (!input)
+            {
+                parse_line(std::string_view(buffer.data(), carried));
+                break;
+            }
+        }
+
+        return games_count;
+    }
+}
+
+#endif
@@ -0,0 +1,84 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_all.hpp>
+#include "bowling_notation.hpp"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace TDD;
+
+static_assert(parse_game("X X X X X X X X X XXX").score() == 300);
+static_assert(parse_game("-- -- -- -- -- -- -- -- -- --").score() == 0);
+static_assert(parse_game("X 7/ 9- X -8 8/ -6 X X X81").score() == 167);
+
+using NotationAndScore = std::pair<std::string, int>;
+
+SCENARIO("Bowling notation - valid games")
+{
+    auto [line, expected_score] = GENERATE(
+        NotationAndScore{ "11 11 11 11 11 11 11 11 11 11", 20 },
+        NotationAndScore{ "5/ 5/ 5/ 5/ 5/ 5/ 5/ 5/ 5/ 5/5", 150 },
+        NotationAndScore{ "9- 9- 9- 9- 9- 9- 9- 9- 9- 9-", 90 },
+        NotationAndScore{ "X 7/ 9- X -8 8/ -6 X X X81", 167 },
+        NotationAndScore{ "X X X X X X X X X X5/", 285 },
+        NotationAndScore{ "  X\tX X X X X X X X XXX\r", 300 });
+
+    WHEN("Game is parsed: " << line)
+    {
+        auto game = parse_game(line);
+
+        THEN("score is " << expected_score)
+        {
+            REQUIRE(game.score() == expected_score);
+        }
+    }
+}
+
+SCENARIO("Bowling notation - invalid games")
+{
+    auto line = GENERATE(
+        std::string(""),
+        std::string("X X X X X X X X X"),
+        std::string("X X X X X X X X X XXX X"),
+        std::string("X1 X X X X X X X X XXX"),
+        std::string("55 X X X X X X X X XXX"),
+        std::string("/5 X X X X X X X X XXX"),
+        std::string("1X X X X X X X X X XXX"),
+        std::string("1a X X X X X X X X XXX"),
+        std::string("X X X X X X X X X XX"),
+        std::string("X X X X X X X X X 5/"),
+        std::string("X X X X X X X X X 81X"),
+        std::string("X X X X X X X X X X55"),
+        std::string("X X X X X X X X X X/X"),
+        std::string("X X X X X X X X X 5/XX"));
+
+    WHEN("Invalid game is parsed: '" << line << "'")
+    {
+        THEN("Should throw exception")
+        {
+            REQUIRE_THROWS_AS(parse_game(line), InvalidNotationException);
+        }
+    }
+}
+
+SCENARIO("Bowling notation - reading games from stream")
+{
+    GIVEN("Stream with games separated by new lines")
+    {
+        std::istringstream input("X X X X X X X X X XXX\r\n\n11 11 11 11 11 11 11 11 11 11\n5/ 5/ 5/ 5/ 5/ 5/ 5/ 5/ 5/ 5/5");
+
+        WHEN("Games are read in chunks smaller than a line")
+        {
+            std::vector<int> scores;
+            auto count = for_each_game(input, [&](const BowlingGame& game) { scores.push_back(game.score()); }, 7);
+
+            THEN("every game is parsed")
+            {
+                REQUIRE(count == 3);
+                REQUIRE(scores == std::vector<int>{300, 20, 150});
+            }
+        }
+    }
+}
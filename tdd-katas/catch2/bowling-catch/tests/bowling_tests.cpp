@@ -1,9 +1,136 @@
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_all.hpp>
 #include "bowling.hpp"
 
+#include <array>
+#include <stdexcept>
+#include <vector>
+
 using namespace std;
+using namespace TDD;
 
 TEST_CASE("simple test")
 {
     REQUIRE(1 == 1);
-}
\ No newline at end of file
+}
+
+namespace ReferenceGames
+{
+    constexpr std::array<int, 20> gutter_game{};
+    constexpr std::array perfect_game{10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10};
+    constexpr std::array all_spares_and_strike{1, 9, 1, 9, 1, 9, 1, 9, 1, 9, 1, 9, 1, 9, 1, 9, 1, 9, 1, 9, 10};
+    constexpr std::array strike_and_spare{10, 4, 6, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1};
+
+    static_assert(TDD::score(gutter_game) == 0);
+    static_assert(TDD::score(perfect_game) == 300);
+    static_assert(TDD::score(all_spares_and_strike) == 119);
+    static_assert(TDD::score(strike_and_spare) == 47);
+
+    // bonus balls of the tenth frame are thrown at a new rack after a strike
+    constexpr std::array strike_with_spare_bonus{1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 10, 6, 4};
+    static_assert(TDD::score(strike_with_spare_bonus) == 38);
+}
+
+SCENARIO("BowlingGame - score")
+{
+    BowlingGame game;
+
+    GIVEN("New game")
+    {
+        THEN("score is zero")
+        {
+            REQUIRE(game.score() == 0);
+        }
+    }
+
+    GIVEN("All rolls without bonus")
+    {
+        for (int i = 0; i < 20; ++i)
+            game.roll(1);
+
+        THEN("score is sum of pins")
+        {
+            REQUIRE(game.score() == 20);
+        }
+    }
+
+    GIVEN("Spare in first frame")
+    {
+        game.roll(5);
+        game.roll(5);
+        for (int i = 0; i < 18; ++i)
+            game.roll(1);
+
+        THEN("next roll is doubled")
+        {
+            REQUIRE(game.score() == 29);
+        }
+    }
+
+    GIVEN("Strike in first frame")
+    {
+        game.roll(10);
+        for (int i = 0; i < 18; ++i)
+            game.roll(1);
+
+        THEN("two next rolls are doubled")
+        {
+            REQUIRE(game.score() == 30);
+        }
+    }
+}
+
+using RollsAndScore = std::pair<std::vector<int>, int>;
+
+SCENARIO("BowlingGame - reference games")
+{
+    auto [rolls, expected_score] = GENERATE(
+        RollsAndScore{ {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, 20 },
+        RollsAndScore{ {0, 8, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, 27 },
+        RollsAndScore{ {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 10, 2, 1}, 31 },
+        RollsAndScore{ {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10}, 300 });
+
+    WHEN("Rolls are scored with free function")
+    {
+        THEN("score is " << expected_score)
+        {
+            REQUIRE(TDD::score(rolls) == expected_score);
+        }
+    }
+}
+
+SCENARIO("BowlingGame - invalid rolls")
+{
+    BowlingGame game;
+
+    THEN("Negative or too many pins throws")
+    {
+        REQUIRE_THROWS_AS(game.roll(-1), std::invalid_argument);
+        REQUIRE_THROWS_AS(game.roll(11), std::invalid_argument);
+    }
+
+    THEN("Second ball knocking down more pins than left in frame throws")
+    {
+        game.roll(6);
+
+        REQUIRE_THROWS_AS(game.roll(6), std::invalid_argument);
+    }
+
+    THEN("Bonus balls of tenth frame knocking down more pins than left in rack throw")
+    {
+        for (int i = 0; i < 18; ++i)
+            game.roll(0);
+        game.roll(10);
+        game.roll(6);
+
+        REQUIRE_THROWS_AS(game.roll(6), std::invalid_argument);
+    }
+
+    THEN("More rolls than allowed in game throws")
+    {
+        for (size_t i = 0; i < BowlingGame::MAX_ROLLS_IN_GAME; ++i)
+            game.roll(0);
+
+        REQUIRE_THROWS_AS(game.roll(0), std::out_of_range);
+    }
+}
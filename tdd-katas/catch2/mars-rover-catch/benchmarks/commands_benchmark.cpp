@@ -0,0 +1,112 @@
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+
+#include "grid_rover.hpp"
+#include "rover.hpp"
+#include "rover_io.hpp"
+
+using namespace std;
+using namespace TDD;
+
+// Usage: commands_benchmark [sequence_length]
+
+namespace
+{
+    string random_sequence(size_t length)
+    {
+        constexpr char commands[] = {'F', 'B', 'L', 'R'};
+
+        mt19937 rnd{42};
+        uniform_int_distribution<int> command_index{0, 3};
+
+        string sequence(length, ' ');
+        for (char& command : sequence)
+            command = commands[command_index(rnd)];
+
+        return sequence;
+    }
+
+    string repetitive_sequence(size_t length)
+    {
+        mt19937 rnd{42};
+        uniform_int_distribution<size_t> run_length{1, 1000};
+
+        string sequence;
+        sequence.reserve(length);
+        while (sequence.size() < length)
+        {
+            sequence.append(min(run_length(rnd), length - sequence.size()), 'F');
+            sequence.append(min<size_t>(2, length - sequence.size()), 'R');
+        }
+
+        return sequence;
+    }
+
+    void run(const char* description, const string& sequence, const Limited2dPlane& plane)
+    {
+        Rover rover({.x = 0, .y = 0, .direction = Direction::N}, plane);
+
+        const auto start = chrono::steady_clock::now();
+        rover.runCommandSequence(sequence);
+        const chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+        cout << description << " - final position: " << rover.getPosition() << "}\n";
+        cout << "  elapsed:      " << elapsed.count() << " s\n";
+        cout << "  commands/s:   " << static_cast<double>(sequence.size()) / elapsed.count() << "\n";
+    }
+
+    template <typename GridRoverType>
+    void run_grid(const char* description, const string& sequence, GridRoverType rover)
+    {
+        const auto start = chrono::steady_clock::now();
+        rover.runCommandSequence(sequence);
+        const chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+        const auto position = rover.getPosition();
+        cout << description << " - final position: {x = " << position.x << ", y = " << position.y << ", dir = " << position.direction << "}\n";
+        cout << "  elapsed:      " << elapsed.count() << " s\n";
+        cout << "  commands/s:   " << static_cast<double>(sequence.size()) / elapsed.count() << "\n";
+    }
+
+    void run_compiled(const char* description, const string& sequence, const Limited2dPlane& plane)
+    {
+        Rover rover({.x = 0, .y = 0, .direction = Direction::N}, plane);
+
+        const auto start = chrono::steady_clock::now();
+        const CommandProgram program = CommandProgram::compile(sequence);
+        const auto compiled = chrono::steady_clock::now();
+        rover.runProgram(program);
+        const auto end = chrono::steady_clock::now();
+
+        const chrono::duration<double> compile_time = compiled - start;
+        const chrono::duration<double> run_time = end - compiled;
+
+        cout << description << " - final position: " << rover.getPosition() << "}\n";
+        cout << "  instructions: " << program.instructions().size() << "\n";
+        cout << "  compile:      " << compile_time.count() << " s\n";
+        cout << "  run:          " << run_time.count() << " s\n";
+        cout << "  commands/s:   " << static_cast<double>(sequence.size()) / run_time.count() << " (run only)\n";
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const size_t length = argc > 1 ? stoull(argv[1]) : 100'000'000;
+    const string sequence = random_sequence(length);
+
+    run("unlimited plane", sequence, Limited2dPlane{});
+    run("limited plane 21x21", sequence, Limited2dPlane{.x_min = -10, .y_min = -10, .x_max = 10, .y_max = 10});
+    run_grid("grid rover - unlimited plane", sequence, GridRover<int32_t>({}));
+    run_grid("grid rover - limited plane 21x21", sequence, GridRover<int32_t, LimitedGrid<int32_t>>({}, LimitedGrid<int32_t>(-10, -10, 10, 10)));
+    run_grid("grid rover - sphere 22x21", sequence, GridRover<int32_t, SphericalGrid<int32_t>>({}, SphericalGrid<int32_t>(22, 21)));
+
+    const string repetitive = repetitive_sequence(length);
+    const Limited2dPlane plane{.x_min = -100, .y_min = -100, .x_max = 100, .y_max = 100};
+
+    run("repetitive sequence - interpreted", repetitive, plane);
+    run_compiled("repetitive sequence - compiled", repetitive, plane);
+
+    return 0;
+}
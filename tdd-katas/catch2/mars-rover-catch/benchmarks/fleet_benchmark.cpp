@@ -0,0 +1,95 @@
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "rover_fleet.hpp"
+
+using namespace std;
+using namespace TDD;
+
+// Usage: fleet_benchmark [rovers_count] [ticks]
+
+namespace
+{
+    constexpr char commands[] = {'F', 'B', 'L', 'R'};
+
+    const Limited2dPlane plane{.x_min = -500, .y_min = -500, .x_max = 500, .y_max = 500};
+
+    Coordinates random_position(mt19937& rnd)
+    {
+        uniform_int_distribution<int> coordinate{-500, 500};
+        uniform_int_distribution<int> direction{0, 3};
+
+        return {.x = double(coordinate(rnd)), .y = double(coordinate(rnd)), .direction = static_cast<Direction>(direction(rnd))};
+    }
+
+    void report(const char* description, size_t rover_commands, chrono::duration<double> elapsed)
+    {
+        cout << description << "\n";
+        cout << "  elapsed:            " << elapsed.count() << " s\n";
+        cout << "  rover commands/s:   " << static_cast<double>(rover_commands) / elapsed.count() << "\n";
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const size_t rovers_count = argc > 1 ? stoull(argv[1]) : 50'000;
+    const size_t ticks = argc > 2 ? stoull(argv[2]) : 1'000;
+
+    mt19937 rnd{42};
+    uniform_int_distribution<int> command_index{0, 3};
+
+    vector<Coordinates> positions(rovers_count);
+    for (auto& position : positions)
+        position = random_position(rnd);
+
+    string tick_commands(ticks, ' ');
+    for (char& command : tick_commands)
+        command = commands[command_index(rnd)];
+
+    {
+        vector<Rover> rovers;
+        for (const auto& position : positions)
+            rovers.emplace_back(position, plane);
+
+        const auto start = chrono::steady_clock::now();
+        for (char command : tick_commands)
+            for (Rover& rover : rovers)
+                rover.runCommand(command);
+        report("vector<Rover> - same command per tick", rovers_count * ticks, chrono::steady_clock::now() - start);
+    }
+
+    for (unsigned threads_count : {1u, max(1u, thread::hardware_concurrency())})
+    {
+        RoverFleet fleet(plane, threads_count);
+        for (const auto& position : positions)
+            fleet.add(position);
+
+        const auto start = chrono::steady_clock::now();
+        for (char command : tick_commands)
+            fleet.runCommand(command);
+        report(("RoverFleet - same command per tick, threads: " + to_string(threads_count)).c_str(), rovers_count * ticks, chrono::steady_clock::now() - start);
+    }
+
+    vector<string> sequences(rovers_count, string(ticks, ' '));
+    for (auto& sequence : sequences)
+        for (char& command : sequence)
+            command = commands[command_index(rnd)];
+    const vector<string_view> streams(sequences.begin(), sequences.end());
+
+    for (unsigned threads_count : {1u, max(1u, thread::hardware_concurrency())})
+    {
+        RoverFleet fleet(plane, threads_count);
+        for (const auto& position : positions)
+            fleet.add(position);
+
+        const auto start = chrono::steady_clock::now();
+        fleet.runCommandStreams(streams);
+        report(("RoverFleet - command stream per rover, threads: " + to_string(threads_count)).c_str(), rovers_count * ticks, chrono::steady_clock::now() - start);
+    }
+
+    return 0;
+}
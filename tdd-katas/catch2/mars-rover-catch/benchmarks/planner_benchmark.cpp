@@ -0,0 +1,60 @@
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+
+#include "path_planner.hpp"
+
+using namespace std;
+using namespace TDD;
+
+// Usage: planner_benchmark [planet_size] [obstacle_percent]
+
+namespace
+{
+    Location random_location(mt19937& rnd, int size)
+    {
+        uniform_int_distribution<int> coordinate{0, size - 1};
+        return { .x = static_cast<double>(coordinate(rnd)), .y = static_cast<double>(coordinate(rnd)) };
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const int size = argc > 1 ? stoi(argv[1]) : 1000;
+    const int obstacle_percent = argc > 2 ? stoi(argv[2]) : 20;
+    constexpr int queries = 100;
+
+    const Limited2dPlane planet{ .x_min = 0, .y_min = 0, .x_max = size - 1.0, .y_max = size - 1.0 };
+
+    mt19937 rnd{42};
+    ObstacleMap obstacles(planet);
+    const auto obstacles_count = static_cast<long long>(size) * size * obstacle_percent / 100;
+    for (long long i = 0; i < obstacles_count; ++i)
+        obstacles.add(random_location(rnd, size));
+
+    PathPlanner planner;
+    size_t found = 0;
+    size_t total_length = 0;
+
+    const auto start_time = chrono::steady_clock::now();
+    for (int query = 0; query < queries; ++query)
+    {
+        const Location from = random_location(rnd, size);
+        const Coordinates start{ .x = from.x, .y = from.y, .direction = Direction::N };
+
+        if (const auto program = planner.plan(start, random_location(rnd, size), planet, obstacles))
+        {
+            ++found;
+            total_length += program->size();
+        }
+    }
+    const chrono::duration<double, milli> elapsed = chrono::steady_clock::now() - start_time;
+
+    cout << "planet:          " << size << "x" << size << ", " << obstacles.size() << " obstacles\n";
+    cout << "queries:         " << queries << " (" << found << " reachable)\n";
+    cout << "avg program:     " << (found ? total_length / found : 0) << " commands\n";
+    cout << "avg query time:  " << elapsed.count() / queries << " ms\n";
+
+    return 0;
+}
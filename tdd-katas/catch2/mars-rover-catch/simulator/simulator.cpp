@@ -0,0 +1,183 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "rover.hpp"
+#include "work_stealing_pool.hpp"
+
+using namespace std;
+using namespace TDD;
+
+// Usage: mars-rover-catch-simulator [runs] [sequence_length] [obstacle_percent] [planet_size]
+// - every run places random obstacles on the planet and drives a rover from a random position with
+//   a random command sequence; the run succeeds when no obstacle stops the sequence
+// - runs are grouped in batches seeded by batch index, so results do not depend on number of threads
+
+namespace
+{
+    constexpr size_t runs_per_batch = 256;
+
+    struct MissionParameters
+    {
+        size_t runs = 0;
+        size_t sequence_length = 0;
+        int obstacle_percent = 0;
+        int planet_size = 0;
+    };
+
+    struct MissionStats
+    {
+        uint64_t runs = 0;
+        uint64_t completed = 0;
+        uint64_t commands = 0;
+    };
+
+    // everything one thread needs for its runs - allocated once, reused by every run
+    struct alignas(64) Worker
+    {
+        mt19937_64 rnd;
+        shared_ptr<ObstacleMap> obstacles;
+        string sequence;
+        MissionStats stats;
+    };
+
+    class Simulator
+    {
+    public:
+        Simulator(const MissionParameters& parameters, unsigned threads_count)
+            : parameters(parameters),
+              planet{ .x_min = 0, .y_min = 0, .x_max = parameters.planet_size - 1.0, .y_max = parameters.planet_size - 1.0 },
+              pool(threads_count), workers(pool.threadsCount())
+        {
+            for (Worker& worker : workers)
+            {
+                worker.obstacles = make_shared<ObstacleMap>(planet);
+                worker.sequence.resize(parameters.sequence_length);
+            }
+        }
+
+        MissionStats run()
+        {
+            for (Worker& worker : workers)
+                worker.stats = {};
+
+            const size_t batches = (parameters.runs + runs_per_batch - 1) / runs_per_batch;
+            pool.run(batches, [this](unsigned thread_index, size_t batch) { runBatch(workers[thread_index], batch); });
+
+            MissionStats total;
+            for (const Worker& worker : workers)
+            {
+                total.runs += worker.stats.runs;
+                total.completed += worker.stats.completed;
+                total.commands += worker.stats.commands;
+            }
+
+            return total;
+        }
+
+    private:
+        MissionParameters parameters;
+        Limited2dPlane planet;
+        WorkStealingPool pool;
+        vector<Worker> workers;
+
+        void runBatch(Worker& worker, size_t batch)
+        {
+            worker.rnd.seed(batch);
+
+            const size_t first_run = batch * runs_per_batch;
+            const size_t last_run = min(parameters.runs, first_run + runs_per_batch);
+
+            for (size_t run = first_run; run < last_run; ++run)
+                runMission(worker);
+        }
+
+        void runMission(Worker& worker)
+        {
+            constexpr char commands[] = {'F', 'B', 'L', 'R'};
+            uniform_int_distribution<int> coordinate{0, parameters.planet_size - 1};
+            uniform_int_distribution<int> command_index{0, 3};
+
+            const Coordinates start{
+                .x = static_cast<double>(coordinate(worker.rnd)),
+                .y = static_cast<double>(coordinate(worker.rnd)),
+                .direction = static_cast<Direction>(command_index(worker.rnd))
+            };
+
+            const long long obstacles_count = 1LL * parameters.planet_size * parameters.planet_size * parameters.obstacle_percent / 100;
+            worker.obstacles->clear();
+            for (long long i = 0; i < obstacles_count; ++i)
+            {
+                const Location obstacle{ .x = static_cast<double>(coordinate(worker.rnd)), .y = static_cast<double>(coordinate(worker.rnd)) };
+                if (obstacle.x != start.x || obstacle.y != start.y)
+                    worker.obstacles->add(obstacle);
+            }
+
+            for (char& command : worker.sequence)
+                command = commands[command_index(worker.rnd)];
+
+            // copies the shared pointer only - no allocation per run
+            Rover rover(start, planet, worker.obstacles);
+            const bool is_blocked = rover.runCommandSequence(worker.sequence).has_value();
+
+            ++worker.stats.runs;
+            worker.stats.completed += !is_blocked;
+            worker.stats.commands += worker.sequence.size();
+        }
+    };
+
+    size_t argument(int argc, char* argv[], int index, size_t default_value)
+    {
+        return argc > index ? stoull(argv[index]) : default_value;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const MissionParameters parameters{
+        .runs = argument(argc, argv, 1, 200'000),
+        .sequence_length = argument(argc, argv, 2, 100),
+        .obstacle_percent = static_cast<int>(argument(argc, argv, 3, 1)),
+        .planet_size = static_cast<int>(argument(argc, argv, 4, 100))
+    };
+
+    if (parameters.planet_size <= 0 || parameters.obstacle_percent < 0 || parameters.obstacle_percent > 100)
+    {
+        cerr << "Invalid planet size or obstacle percent\n";
+        return 1;
+    }
+
+    cout << "runs:            " << parameters.runs << "\n";
+    cout << "sequence length: " << parameters.sequence_length << "\n";
+    cout << "obstacles:       " << parameters.obstacle_percent << "% of " << parameters.planet_size << "x" << parameters.planet_size << "\n\n";
+
+    const unsigned max_threads = max(thread::hardware_concurrency(), 1u);
+    double single_thread_rate = 0;
+
+    for (unsigned threads = 1; threads <= max_threads; threads = threads == max_threads ? threads + 1 : min(threads * 2, max_threads))
+    {
+        Simulator simulator(parameters, threads);
+
+        const auto start = chrono::steady_clock::now();
+        const MissionStats stats = simulator.run();
+        const chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+        const double runs_per_second = static_cast<double>(stats.runs) / elapsed.count();
+        if (threads == 1)
+            single_thread_rate = runs_per_second;
+
+        cout << "threads: " << threads
+             << "  success rate: " << 100.0 * static_cast<double>(stats.completed) / static_cast<double>(max<uint64_t>(stats.runs, 1)) << "%"
+             << "  runs/s: " << runs_per_second
+             << "  commands/s: " << static_cast<double>(stats.commands) / elapsed.count()
+             << "  speedup: " << runs_per_second / single_thread_rate << "\n";
+    }
+
+    return 0;
+}
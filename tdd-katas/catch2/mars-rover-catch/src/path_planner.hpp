@@ -0,0 +1,205 @@
+#ifndef PATH_PLANNER_HPP
+#define PATH_PLANNER_HPP
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "grid_rover.hpp"
+
+namespace TDD
+{
+  // shortest F/B/L/R program between two squares of a limited planet with obstacles
+  // - A* over (x, y, direction) states with wrap-around manhattan distance as heuristic; every command costs 1
+  //   and changes f by 0, 1 or 2, so the open list is three rotating buckets instead of a heap
+  // - visited states take one bit each and all buffers are kept between queries, so repeated plans do not allocate
+  // - one planner per thread
+  class PathPlanner
+  {
+  public:
+	// returns program which brings rover from start to target (facing any direction) - nullopt when target is unreachable
+	std::optional<std::string> plan(const Coordinates& start, const Location& target, const Limited2dPlane& planet_limit, const ObstacleMap& obstacles)
+	{
+	  setPlanet(planet_limit);
+
+	  const uint32_t start_cell = cell(start.x, start.y);
+	  const uint32_t target_cell = cell(target.x, target.y);
+	  target_column = target_cell % width;
+	  target_row = target_cell / width;
+
+	  if (obstacles.contains(x_min + target_column, y_min + target_row))
+		return std::nullopt;
+
+	  const uint32_t start_state = start_cell * 4 + static_cast<uint32_t>(start.direction);
+
+	  for (std::vector<uint64_t>& bucket : buckets)
+		bucket.clear();
+	  buckets[0].push_back(entry(start_state, 0));
+
+	  for (size_t f = 0; !(buckets[0].empty() && buckets[1].empty() && buckets[2].empty()); ++f)
+	  {
+		std::vector<uint64_t>& open = buckets[f % 3];
+
+		while (!open.empty())
+		{
+		  const uint64_t current = open.back();
+		  open.pop_back();
+
+		  const auto state = static_cast<uint32_t>(current >> 2);
+		  if (isVisited(state))
+			continue;
+
+		  visited[state / 64] |= uint64_t{ 1 } << (state % 64);
+		  came_by[state] = static_cast<uint8_t>(current & 3u);
+
+		  if (state / 4 == target_cell)
+			return program(start_state, state);
+
+		  expand(state, f, obstacles);
+		}
+	  }
+
+	  return std::nullopt;
+	}
+
+  private:
+	enum Command : uint8_t { forward, backward, right, left };
+	static constexpr std::array<char, 4> command_symbols{ 'F', 'B', 'R', 'L' };
+
+	int64_t x_min = 0, y_min = 0;
+	uint32_t width = 0, height = 0;
+	uint32_t target_column = 0, target_row = 0;
+
+	// search arena - reused by all queries
+	std::vector<uint64_t> visited;         // one bit per state
+	std::vector<uint8_t> came_by;          // command which reached the state - valid for visited states only
+	std::array<std::vector<uint64_t>, 3> buckets; // open states with f, f + 1 and f + 2 - state << 2 | command
+
+	void setPlanet(const Limited2dPlane& planet_limit)
+	{
+	  if (!(planet_limit.x_min <= planet_limit.x_max && planet_limit.y_min <= planet_limit.y_max))
+		throw std::invalid_argument("path planning needs limited planet");
+
+	  x_min = std::llround(planet_limit.x_min);
+	  y_min = std::llround(planet_limit.y_min);
+	  const auto columns = static_cast<uint64_t>(std::llround(planet_limit.x_max) - x_min + 1);
+	  const auto rows = static_cast<uint64_t>(std::llround(planet_limit.y_max) - y_min + 1);
+
+	  if (columns * rows > std::numeric_limits<uint32_t>::max() / 4)
+		throw std::invalid_argument("planet too large for path planning");
+
+	  width = static_cast<uint32_t>(columns);
+	  height = static_cast<uint32_t>(rows);
+
+	  const size_t states = size_t{ width } * height * 4;
+	  visited.assign((states + 63) / 64, 0);
+	  if (came_by.size() < states)
+		came_by.resize(states);
+	}
+
+	uint32_t cell(double x, double y) const
+	{
+	  const auto column = static_cast<uint64_t>(std::llround(x) - x_min);
+	  const auto row = static_cast<uint64_t>(std::llround(y) - y_min);
+
+	  if (column >= width || row >= height)
+		throw std::out_of_range("position outside of planet");
+
+	  return static_cast<uint32_t>(row * width + column);
+	}
+
+	static uint64_t entry(uint32_t state, uint8_t command)
+	{
+	  return (uint64_t{ state } << 2) | command;
+	}
+
+	bool isVisited(uint32_t state) const
+	{
+	  return (visited[state / 64] >> (state % 64)) & 1u;
+	}
+
+	uint32_t distanceToTarget(uint32_t column, uint32_t row) const
+	{
+	  const uint32_t dx = column > target_column ? column - target_column : target_column - column;
+	  const uint32_t dy = row > target_row ? row - target_row : target_row - row;
+
+	  return std::min(dx, width - dx) + std::min(dy, height - dy);
+	}
+
+	// state of the neighbouring square in direction (rotated by half turn when step is -1)
+	uint32_t moved(uint32_t state, int step) const
+	{
+	  const uint32_t direction = state & 3u;
+	  uint32_t column = state / 4 % width;
+	  uint32_t row = state / 4 / width;
+
+	  const int delta_x = step * Details::grid_delta_x[direction];
+	  const int delta_y = step * Details::grid_delta_y[direction];
+	  column = delta_x > 0 ? (column + 1 == width ? 0 : column + 1) : delta_x < 0 ? (column == 0 ? width - 1 : column - 1) : column;
+	  row = delta_y > 0 ? (row + 1 == height ? 0 : row + 1) : delta_y < 0 ? (row == 0 ? height - 1 : row - 1) : row;
+
+	  return (row * width + column) * 4 + direction;
+	}
+
+	static uint32_t turned(uint32_t state, unsigned quarter_turns)
+	{
+	  return (state & ~3u) | ((state + quarter_turns) & 3u);
+	}
+
+	void expand(uint32_t state, size_t f, const ObstacleMap& obstacles)
+	{
+	  const uint32_t distance = distanceToTarget(state / 4 % width, state / 4 / width);
+
+	  for (const auto& [step, command] : { std::pair{ 1, forward }, std::pair{ -1, backward } })
+	  {
+		const uint32_t next = moved(state, step);
+		const uint32_t column = next / 4 % width;
+		const uint32_t row = next / 4 / width;
+
+		if (isVisited(next) || obstacles.contains(x_min + column, y_min + row))
+		  continue;
+
+		// move changes heuristic by at most one - f grows by zero to two
+		buckets[(f + 1 + distanceToTarget(column, row) - distance) % 3].push_back(entry(next, command));
+	  }
+
+	  for (const auto& [quarter_turns, command] : { std::pair{ 1u, right }, std::pair{ 3u, left } })
+	  {
+		const uint32_t next = turned(state, quarter_turns);
+		if (!isVisited(next))
+		  buckets[(f + 1) % 3].push_back(entry(next, command));
+	  }
+	}
+
+	std::string program(uint32_t start_state, uint32_t target_state) const
+	{
+	  std::string commands;
+
+	  for (uint32_t state = target_state; state != start_state;)
+	  {
+		const auto command = static_cast<Command>(came_by[state]);
+		commands += command_symbols[command];
+
+		switch (command)
+		{
+		case forward: state = moved(state, -1); break;
+		case backward: state = moved(state, 1); break;
+		case right: state = turned(state, 3); break;
+		case left: state = turned(state, 1); break;
+		}
+	  }
+
+	  std::reverse(commands.begin(), commands.end());
+	  return commands;
+	}
+  };
+}
+
+#endif
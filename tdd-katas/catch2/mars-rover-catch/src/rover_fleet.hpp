@@ -0,0 +1,272 @@
+#ifndef ROVER_FLEET_HPP
+#define ROVER_FLEET_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "rover.hpp"
+#include "work_stealing_pool.hpp"
+
+namespace TDD
+{
+  class FleetRover;
+
+  namespace Details
+  {
+	constexpr size_t cache_line_size = 64;
+
+	// allocates arrays starting on a cache line
+	template <typename T>
+	struct CacheLineAllocator
+	{
+	  using value_type = T;
+
+	  CacheLineAllocator() = default;
+
+	  template <typename U>
+	  constexpr CacheLineAllocator(const CacheLineAllocator<U>&) noexcept
+	  {}
+
+	  T* allocate(size_t count)
+	  {
+		return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t{ cache_line_size }));
+	  }
+
+	  void deallocate(T* pointer, size_t count) noexcept
+	  {
+		::operator delete(pointer, count * sizeof(T), std::align_val_t{ cache_line_size });
+	  }
+
+	  template <typename U>
+	  bool operator==(const CacheLineAllocator<U>&) const noexcept
+	  {
+		return true;
+	  }
+	};
+
+	template <typename T>
+	using CacheLineVector = std::vector<T, CacheLineAllocator<T>>;
+  }
+
+  // many rovers on one planet stored as structure of arrays (x, y and direction in separate contiguous arrays)
+  // - commands are applied with loops the compiler can vectorize, large fleets are split across threads
+  //   of a pool started by the first command which needs more than one thread
+  class RoverFleet
+  {
+  public:
+	static constexpr size_t min_rovers_per_thread = 4096;
+
+	explicit RoverFleet(const Limited2dPlane& planet_limit = {}, unsigned threads_count = std::thread::hardware_concurrency())
+	  : wrap_bounds(planet_limit), threads_count(std::max(threads_count, 1u))
+	{}
+
+	size_t add(const Coordinates& coordinates)
+	{
+	  xs.push_back(coordinates.x);
+	  ys.push_back(coordinates.y);
+	  directions.push_back(static_cast<uint8_t>(coordinates.direction));
+
+	  return xs.size() - 1;
+	}
+
+	size_t size() const
+	{
+	  return xs.size();
+	}
+
+	Coordinates getPosition(size_t index) const
+	{
+	  return { .x = xs[index], .y = ys[index], .direction = static_cast<Direction>(directions[index]) };
+	}
+
+	FleetRover rover(size_t index);
+
+	// applies the same command to every rover
+	void runCommand(char command)
+	{
+	  const Details::CommandStep& step = Details::command_steps[static_cast<unsigned char>(command)];
+
+	  if (!step.is_supported)
+		throw NotSupportedCommandException();
+
+	  parallelFor([this, step](size_t begin, size_t end) { applyStep(begin, end, step); });
+	}
+
+	// runs streams[i] on i-th rover - all streams are validated before any rover moves
+	void runCommandStreams(std::span<const std::string_view> streams)
+	{
+	  if (streams.size() != size())
+		throw std::invalid_argument("number of command streams differs from number of rovers");
+
+	  for (std::string_view stream : streams)
+	  {
+		const bool is_supported = std::all_of(stream.begin(), stream.end(), [](char command) {
+		  return Details::command_steps[static_cast<unsigned char>(command)].is_supported;
+		});
+
+		if (!is_supported)
+		  throw NotSupportedCommandException();
+	  }
+
+	  parallelFor([this, streams](size_t begin, size_t end) {
+		for (size_t index = begin; index < end; ++index)
+		  runStream(index, streams[index]);
+	  });
+	}
+
+  private:
+	friend class FleetRover;
+
+	Details::CacheLineVector<double> xs;
+	Details::CacheLineVector<double> ys;
+	Details::CacheLineVector<uint8_t> directions;
+	Details::WrapBounds wrap_bounds;
+	unsigned threads_count;
+	std::unique_ptr<WorkStealingPool> pool;
+
+	void applyStep(size_t begin, size_t end, Details::CommandStep step)
+	{
+	  double* const x = xs.data();
+	  double* const y = ys.data();
+	  uint8_t* const direction = directions.data();
+	  const Details::WrapBounds bounds = wrap_bounds;
+	  const double move = step.move;
+	  const unsigned turn = step.turn;
+
+	  for (size_t index = begin; index < end; ++index)
+	  {
+		// N = 0, E = 1, S = 2, W = 3 - unit vector computed without table lookup
+		const int current_direction = direction[index];
+		const int sign = 1 - (current_direction & 2);
+		const double delta_x = (current_direction & 1) * sign;
+		const double delta_y = (1 - (current_direction & 1)) * sign;
+
+		x[index] = Details::wrap_step(x[index], move * delta_x, bounds.x_min, bounds.x_max);
+		y[index] = Details::wrap_step(y[index], move * delta_y, bounds.y_min, bounds.y_max);
+		direction[index] = static_cast<uint8_t>((current_direction + turn) & 3u);
+	  }
+	}
+
+	void runStream(size_t index, std::string_view stream)
+	{
+	  double x = xs[index];
+	  double y = ys[index];
+	  unsigned direction = directions[index];
+
+	  for (char command : stream)
+	  {
+		const Details::CommandStep& step = Details::command_steps[static_cast<unsigned char>(command)];
+
+		x = Details::wrap_step(x, step.move * Details::delta_x[direction], wrap_bounds.x_min, wrap_bounds.x_max);
+		y = Details::wrap_step(y, step.move * Details::delta_y[direction], wrap_bounds.y_min, wrap_bounds.y_max);
+		direction = (direction + step.turn) & 3u;
+	  }
+
+	  xs[index] = x;
+	  ys[index] = y;
+	  directions[index] = static_cast<uint8_t>(direction);
+	}
+
+	// splits [0, size()) into contiguous chunks - about one per thread
+	// - chunk size is a multiple of rovers per cache line of directions (the narrowest array), so with arrays
+	//   starting on a cache line every chunk starts on one in all arrays and threads never share a line
+	template <typename Kernel>
+	void parallelFor(Kernel kernel)
+	{
+	  constexpr size_t rovers_per_cache_line = Details::cache_line_size / sizeof(uint8_t);
+
+	  const size_t count = size();
+	  const size_t chunks = std::clamp<size_t>(count / min_rovers_per_thread, 1, threads_count);
+
+	  if (chunks == 1)
+	  {
+		kernel(0, count);
+		return;
+	  }
+
+	  size_t chunk_size = (count + chunks - 1) / chunks;
+	  chunk_size = (chunk_size + rovers_per_cache_line - 1) / rovers_per_cache_line * rovers_per_cache_line;
+
+	  if (!pool)
+		pool = std::make_unique<WorkStealingPool>(threads_count);
+
+	  pool->run((count + chunk_size - 1) / chunk_size, [&kernel, count, chunk_size](unsigned, size_t chunk) {
+		const size_t begin = chunk * chunk_size;
+		kernel(begin, std::min(count, begin + chunk_size));
+	  });
+	}
+  };
+
+  // Rover interface over a single slot of a fleet
+  class FleetRover
+  {
+  public:
+	FleetRover(RoverFleet& fleet, size_t index) : fleet(&fleet), index(index) {}
+
+	Coordinates getPosition() const
+	{
+	  return fleet->getPosition(index);
+	}
+
+	// fleets have no obstacles - like Rover returns false only when a move is blocked
+	bool moveForward()
+	{
+	  return runCommand('F');
+	}
+
+	bool moveBackward()
+	{
+	  return runCommand('B');
+	}
+
+	void turnRight()
+	{
+	  runCommand('R');
+	}
+
+	void turnLeft()
+	{
+	  runCommand('L');
+	}
+
+	std::optional<Location> runCommandSequence(std::string_view sequence)
+	{
+	  for (char command : sequence)
+	  {
+		runCommand(command);
+	  }
+
+	  return std::nullopt;
+	}
+
+	bool runCommand(char command)
+	{
+	  const Details::CommandStep& step = Details::command_steps[static_cast<unsigned char>(command)];
+
+	  if (!step.is_supported)
+		throw NotSupportedCommandException();
+
+	  fleet->applyStep(index, index + 1, step);
+	  return true;
+	}
+
+  private:
+	RoverFleet* fleet;
+	size_t index;
+  };
+
+  inline FleetRover RoverFleet::rover(size_t index)
+  {
+	return FleetRover(*this, index);
+  }
+}
+
+#endif
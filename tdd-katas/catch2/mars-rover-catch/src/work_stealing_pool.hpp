@@ -0,0 +1,177 @@
+#ifndef WORK_STEALING_POOL_HPP
+#define WORK_STEALING_POOL_HPP
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace TDD
+{
+    // fixed set of threads running indexed tasks [0, tasks_count)
+    // - every thread starts with a contiguous range of tasks and takes them from the front
+    // - a thread with an empty range steals the back half of another thread's range
+    // - the calling thread works as thread 0, so a pool of one thread has no workers
+    class WorkStealingPool
+    {
+    public:
+        explicit WorkStealingPool(unsigned threads_count) : ranges(std::max(threads_count, 1u))
+        {
+            workers.reserve(ranges.size() - 1);
+            for (unsigned index = 1; index < ranges.size(); ++index)
+                workers.emplace_back([this, index](std::stop_token stop) { workerLoop(stop, index); });
+        }
+
+        unsigned threadsCount() const
+        {
+            return static_cast<unsigned>(ranges.size());
+        }
+
+        // calls task(thread_index, task_index) for every task index and waits until all of them are done
+        // - the first exception thrown by a task is rethrown when all threads are done; remaining tasks still run
+        void run(size_t tasks_count, std::function<void(unsigned, size_t)> task)
+        {
+            {
+                std::lock_guard lock(mutex);
+                job = std::move(task);
+
+                const size_t threads = ranges.size();
+                for (size_t index = 0; index < threads; ++index)
+                {
+                    std::lock_guard range_lock(ranges[index].mutex);
+                    ranges[index].begin = tasks_count * index / threads;
+                    ranges[index].end = tasks_count * (index + 1) / threads;
+                }
+
+                running = static_cast<unsigned>(workers.size());
+                ++generation;
+            }
+            wake.notify_all();
+
+            workCatching(0);
+
+            std::unique_lock lock(mutex);
+            done.wait(lock, [this] { return running == 0; });
+
+            if (error)
+                std::rethrow_exception(std::exchange(error, nullptr));
+        }
+
+    private:
+        struct alignas(64) Range
+        {
+            std::mutex mutex;
+            size_t begin = 0, end = 0;
+        };
+
+        std::vector<Range> ranges;
+        std::mutex mutex;
+        std::condition_variable_any wake;
+        std::condition_variable_any done;
+        std::function<void(unsigned, size_t)> job;
+        uint64_t generation = 0;
+        unsigned running = 0;
+        std::exception_ptr error; // first exception of the current run
+        std::vector<std::jthread> workers; // declared last - threads stop before the state they use is destroyed
+
+        void workerLoop(std::stop_token stop, unsigned index)
+        {
+            uint64_t seen_generation = 0;
+
+            while (true)
+            {
+                {
+                    std::unique_lock lock(mutex);
+                    if (!wake.wait(lock, stop, [&] { return generation != seen_generation; }))
+                        return;
+                    seen_generation = generation;
+                }
+
+                workCatching(index);
+
+                {
+                    std::lock_guard lock(mutex);
+                    --running;
+                }
+                done.notify_one();
+            }
+        }
+
+        // keeps taking tasks after a task throws, so other tasks of the run are not left over
+        void workCatching(unsigned index)
+        {
+            while (true)
+            {
+                try
+                {
+                    work(index);
+                    return;
+                }
+                catch (...)
+                {
+                    std::lock_guard lock(mutex);
+                    if (!error)
+                        error = std::current_exception();
+                }
+            }
+        }
+
+        void work(unsigned index)
+        {
+            size_t task_index = 0;
+
+            while (takeOwn(index, task_index) || stealFor(index, task_index))
+                job(index, task_index);
+        }
+
+        bool takeOwn(unsigned index, size_t& task_index)
+        {
+            Range& own = ranges[index];
+            std::lock_guard lock(own.mutex);
+
+            if (own.begin == own.end)
+                return false;
+
+            task_index = own.begin++;
+            return true;
+        }
+
+        // moves back half of the first non-empty range of other threads to own range and takes its first task
+        bool stealFor(unsigned index, size_t& task_index)
+        {
+            const size_t threads = ranges.size();
+
+            for (size_t offset = 1; offset < threads; ++offset)
+            {
+                Range& victim = ranges[(index + offset) % threads];
+                size_t begin = 0, end = 0;
+                {
+                    std::lock_guard lock(victim.mutex);
+                    if (victim.begin == victim.end)
+                        continue;
+
+                    begin = victim.begin + (victim.end - victim.begin) / 2;
+                    end = victim.end;
+                    victim.end = begin;
+                }
+
+                Range& own = ranges[index];
+                std::lock_guard lock(own.mutex);
+                own.begin = begin + 1;
+                own.end = end;
+                task_index = begin;
+                return true;
+            }
+
+            return false;
+        }
+    };
+}
+
+#endif
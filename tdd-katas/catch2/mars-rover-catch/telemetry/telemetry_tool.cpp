@@ -0,0 +1,122 @@
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "rover.hpp"
+#include "rover_io.hpp"
+#include "telemetry_io.hpp"
+
+using namespace std;
+using namespace TDD;
+
+// Usage:
+//   mars-rover-catch-telemetry record <file> <commands> [x y direction [x_min y_min x_max y_max]]
+//     runs commands on a rover with telemetry attached and dumps the trajectory
+//   mars-rover-catch-telemetry replay <file>
+//     prints the trajectory and runs the recorded commands again to check every recorded position
+
+namespace
+{
+    Direction parse_direction(string_view symbol)
+    {
+        constexpr string_view symbols = "NESW";
+        const size_t index = symbols.find(symbol);
+        if (symbol.size() != 1 || index == string_view::npos)
+            throw invalid_argument("direction must be one of N, E, S, W");
+
+        return static_cast<Direction>(index);
+    }
+
+    int record(int argc, char* argv[])
+    {
+        const string_view commands = argv[3];
+        Coordinates start;
+        Limited2dPlane planet_limit;
+
+        if (argc >= 7)
+            start = { .x = stod(argv[4]), .y = stod(argv[5]), .direction = parse_direction(argv[6]) };
+        if (argc >= 11)
+            planet_limit = { .x_min = stod(argv[7]), .y_min = stod(argv[8]), .x_max = stod(argv[9]), .y_max = stod(argv[10]) };
+
+        TelemetryRing ring(commands.size());
+        Rover rover(start, planet_limit);
+        rover.attachTelemetry(&ring);
+        rover.runCommandSequence(commands);
+
+        vector<TelemetryRecord> records;
+        ring.drain([&](const TelemetryRecord& record) { records.push_back(record); });
+
+        ofstream file(argv[2], ios::binary);
+        Telemetry::dump(file, start, planet_limit, records);
+
+        cout << records.size() << " records written to " << argv[2] << "\n";
+        return 0;
+    }
+
+    int replay(const char* path)
+    {
+        ifstream file(path, ios::binary);
+        if (!file)
+        {
+            cerr << "Cannot open " << path << "\n";
+            return 1;
+        }
+
+        vector<TelemetryRecord> records;
+        const Telemetry::Header header = Telemetry::load(file, records);
+
+        cout << "start:  " << header.start << "}\n";
+        cout << "planet: " << header.planet_limit << "\n";
+
+        Rover rover(header.start, header.planet_limit);
+        for (size_t index = 0; index < records.size(); ++index)
+        {
+            const TelemetryRecord& record = records[index];
+            cout << index << ": " << record.command << " -> {x = " << record.x << ", y = " << record.y << ", dir = " << record.direction << "}\n";
+
+            rover.runCommand(record.command);
+            const Coordinates position = rover.getPosition();
+
+            const bool matches = lround(position.x) == record.x && lround(position.y) == record.y && position.direction == record.direction;
+            if (!matches)
+            {
+                cerr << "Replay diverges at record " << index << ": rover is at " << position << "}\n";
+                return 1;
+            }
+        }
+
+        cout << records.size() << " records replayed\n";
+        return 0;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const string_view mode = argc > 1 ? argv[1] : "";
+
+    try
+    {
+        if (mode == "record" && argc >= 4)
+            return record(argc, argv);
+        if (mode == "replay" && argc == 3)
+            return replay(argv[2]);
+    }
+    catch (const NotSupportedCommandException&)
+    {
+        cerr << "Not supported command\n";
+        return 1;
+    }
+    catch (const exception& error)
+    {
+        cerr << error.what() << "\n";
+        return 1;
+    }
+
+    cerr << "Usage: " << argv[0] << " record <file> <commands> [x y direction [x_min y_min x_max y_max]]\n";
+    cerr << "       " << argv[0] << " replay <file>\n";
+    return 1;
+}
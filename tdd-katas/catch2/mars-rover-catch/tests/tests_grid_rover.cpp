@@ -0,0 +1,150 @@
+#include "grid_rover.hpp"
+#include "rover_io.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_all.hpp>
+#include <random>
+#include <string>
+
+using namespace std;
+using namespace TDD;
+
+static_assert(sizeof(GridRover<int32_t>) == sizeof(GridCoordinates<int32_t>));
+static_assert(sizeof(GridCoordinates<int32_t>) * 2 <= sizeof(Coordinates));
+
+static_assert([] {
+  GridRover<int16_t, LimitedGrid<int16_t>> rover({ .x = 0, .y = 0, .direction = Direction::N }, LimitedGrid<int16_t>(-2, -2, 2, 2));
+  rover.runCommandSequence("FFFRB");
+  return rover.getPosition() == GridCoordinates<int16_t>{ .x = -1, .y = -2, .direction = Direction::E };
+}());
+
+SCENARIO("Grid rover - same moves as Rover")
+{
+  auto seed = GENERATE(1u, 2u, 3u);
+
+  std::mt19937 rnd{ seed };
+  std::string sequence(10'000, ' ');
+  for (char& command : sequence)
+	command = "FBLR"[rnd() % 4];
+
+  GIVEN("Random command sequence")
+  {
+	WHEN("Run on unlimited planet")
+	{
+	  GridRover<int32_t> grid_rover({ .x = 3, .y = -4, .direction = Direction::S });
+	  grid_rover.runCommandSequence(sequence);
+
+	  Rover rover({ .x = 3, .y = -4, .direction = Direction::S });
+	  rover.runCommandSequence(sequence);
+
+	  THEN("position is the same as for Rover")
+	  {
+		const auto position = grid_rover.getPosition();
+		REQUIRE(Coordinates{ .x = double(position.x), .y = double(position.y), .direction = position.direction } == rover.getPosition());
+	  }
+	}
+
+	WHEN("Run on limited planet")
+	{
+	  GridRover<int64_t, LimitedGrid<int64_t>> grid_rover({ .x = 3, .y = -4, .direction = Direction::S }, LimitedGrid<int64_t>(-5, -7, 6, 8));
+	  grid_rover.runCommandSequence(sequence);
+
+	  Rover rover({ .x = 3, .y = -4, .direction = Direction::S }, Limited2dPlane{ .x_min = -5, .y_min = -7, .x_max = 6, .y_max = 8 });
+	  rover.runCommandSequence(sequence);
+
+	  THEN("position is the same as for Rover")
+	  {
+		const auto position = grid_rover.getPosition();
+		REQUIRE(Coordinates{ .x = double(position.x), .y = double(position.y), .direction = position.direction } == rover.getPosition());
+	  }
+	}
+  }
+}
+
+SCENARIO("Grid rover - unsupported command")
+{
+  GIVEN("Grid rover")
+  {
+	GridRover<> rover({});
+
+	THEN("Unsupported command throws")
+	{
+	  REQUIRE_THROWS_AS(rover.runCommandSequence("FFx"), NotSupportedCommandException);
+	}
+  }
+}
+
+
+using SphereRover = GridRover<int32_t, SphericalGrid<int32_t>>;
+using GridPositions = std::pair<GridCoordinates<int32_t>, GridCoordinates<int32_t>>;
+
+const SphericalGrid<int32_t> sphere(36, 18);
+
+SCENARIO("Grid rover - crossing poles of spherical planet")
+{
+  auto [start_position, expected_position] = GENERATE(
+	GridPositions{ { .x = 0, .y = 17, .direction = Direction::N }, { .x = 18, .y = 17, .direction = Direction::S } },
+	GridPositions{ { .x = 30, .y = 17, .direction = Direction::N }, { .x = 12, .y = 17, .direction = Direction::S } },
+	GridPositions{ { .x = 5, .y = 0, .direction = Direction::S }, { .x = 23, .y = 0, .direction = Direction::N } },
+	GridPositions{ { .x = 5, .y = 10, .direction = Direction::N }, { .x = 5, .y = 11, .direction = Direction::N } },
+	GridPositions{ { .x = 35, .y = 0, .direction = Direction::E }, { .x = 0, .y = 0, .direction = Direction::E } });
+
+  GIVEN("Rover on spherical planet at " << start_position.x << ", " << start_position.y << ", " << start_position.direction)
+  {
+	SphereRover rover(start_position, sphere);
+
+	WHEN("Moved forward")
+	{
+	  rover.moveForward();
+
+	  THEN("Position changed to " << expected_position.x << ", " << expected_position.y << ", " << expected_position.direction)
+	  {
+		REQUIRE(rover.getPosition() == expected_position);
+	  }
+	}
+  }
+}
+
+SCENARIO("Grid rover - moving backward across pole of spherical planet")
+{
+  GIVEN("Rover facing north next to the south pole")
+  {
+	SphereRover rover({ .x = 2, .y = 0, .direction = Direction::N }, sphere);
+
+	WHEN("Moved backward twice")
+	{
+	  rover.moveBackward();
+	  rover.moveBackward();
+
+	  THEN("Rover crossed the pole and moves away from it")
+	  {
+		REQUIRE(rover.getPosition() == GridCoordinates<int32_t>{ .x = 20, .y = 1, .direction = Direction::S });
+	  }
+	}
+  }
+}
+
+SCENARIO("Grid rover - travelling around spherical planet")
+{
+  auto start_position = GENERATE(
+	GridCoordinates<int32_t>{ .x = 0, .y = 0, .direction = Direction::N },
+	GridCoordinates<int32_t>{ .x = 7, .y = 9, .direction = Direction::S },
+	GridCoordinates<int32_t>{ .x = 35, .y = 17, .direction = Direction::E });
+
+  GIVEN("Rover on spherical planet")
+  {
+	SphereRover rover(start_position, sphere);
+
+	WHEN("Rover goes around the planet and turns in place")
+	{
+	  const std::string around_meridian(2 * 18, 'F');
+	  const std::string around_parallel(36, 'F');
+	  rover.runCommandSequence(around_meridian + "LRRL" + around_parallel);
+
+	  THEN("it is back at start position")
+	  {
+		REQUIRE(rover.getPosition() == start_position);
+	  }
+	}
+  }
+}
@@ -1,4 +1,5 @@
 #include "rover.hpp"
+#include "rover_io.hpp"
 
 #include <array>
 #include <catch2/catch_test_macros.hpp>
@@ -232,3 +233,64 @@ SCENARIO("Rover - unsupported command")
 	}
 }
 
+
+
+SCENARIO("Rover - compiled command program")
+{
+  auto command_sequence = GENERATE(
+	std::string("FFFFFFFFFFRRFFFF"),
+	std::string("LLFFBBRR"),
+	std::string("FFFFFL"),
+	std::string("RRRRRFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFLLLLLLBBBBBBBBBBBBBBBBBBBBBB"),
+	std::string("FBFBFBRLRLRFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF"));
+  auto limit = GENERATE(Limited2dPlane{}, Limited2dPlane{ .x_min = -10, .y_min = -10, .x_max = 10, .y_max = 10 }, planet_limit);
+
+  GIVEN("Rover - initialized with position " << start_coordinates << " on planet " << limit)
+  {
+	Rover rover(start_coordinates, limit);
+
+	WHEN("Compiled program is run: " << command_sequence)
+	{
+	  rover.runProgram(CommandProgram::compile(command_sequence));
+
+	  THEN("Position is the same as after running command sequence")
+	  {
+		Rover interpreting_rover(start_coordinates, limit);
+		interpreting_rover.runCommandSequence(command_sequence);
+
+		REQUIRE(rover.getPosition() == interpreting_rover.getPosition());
+	  }
+	}
+  }
+}
+
+SCENARIO("Rover - compiling command program")
+{
+  GIVEN("Repetitive command sequence")
+  {
+	const std::string command_sequence = "FFFFFFFFFFRRFFFFLLLLLBBB";
+
+	WHEN("Program is compiled")
+	{
+	  auto program = CommandProgram::compile(command_sequence);
+
+	  THEN("Runs are folded into single instructions")
+	  {
+		using Instruction = CommandProgram::Instruction;
+
+		REQUIRE(program.commandsCount() == command_sequence.size());
+		REQUIRE(program.instructions() == std::vector<Instruction>{ {.distance = 10, .turn = 2}, {.distance = 4, .turn = 3}, {.distance = -3, .turn = 0} });
+	  }
+	}
+  }
+
+  GIVEN("Sequence with unsupported command")
+  {
+	const std::string command_sequence = "FFFFRRx";
+
+	THEN("Compilation throws before any command is run")
+	{
+	  REQUIRE_THROWS_AS(CommandProgram::compile(command_sequence), NotSupportedCommandException);
+	}
+  }
+}
@@ -0,0 +1,160 @@
+#include "rover.hpp"
+#include "rover_io.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_all.hpp>
+#include <memory>
+#include <optional>
+#include <string>
+
+using namespace std;
+using namespace TDD;
+
+SCENARIO("Obstacle map - limited planet")
+{
+  GIVEN("Obstacle map for planet 10001x10001")
+  {
+	ObstacleMap obstacles(Limited2dPlane{ .x_min = -5000, .y_min = -5000, .x_max = 5000, .y_max = 5000 });
+
+	WHEN("Obstacles are added")
+	{
+	  obstacles.add({ .x = -5000, .y = -5000 });
+	  obstacles.add({ .x = 5000, .y = 5000 });
+	  obstacles.add({ .x = 3, .y = -7 });
+	  obstacles.add({ .x = 3, .y = -7 });
+
+	  THEN("only those squares contain obstacles")
+	  {
+		REQUIRE(obstacles.size() == 3);
+		REQUIRE(obstacles.contains({ .x = -5000, .y = -5000 }));
+		REQUIRE(obstacles.contains({ .x = 5000, .y = 5000 }));
+		REQUIRE(obstacles.contains({ .x = 3, .y = -7 }));
+		REQUIRE_FALSE(obstacles.contains({ .x = -7, .y = 3 }));
+		REQUIRE_FALSE(obstacles.contains({ .x = 5001, .y = 5000 }));
+	  }
+	}
+
+	WHEN("Obstacle outside of planet is added")
+	{
+	  THEN("Should throw exception")
+	  {
+		REQUIRE_THROWS_AS(obstacles.add({ .x = 5001, .y = 0 }), std::out_of_range);
+	  }
+	}
+
+	WHEN("Obstacles are cleared")
+	{
+	  obstacles.add({ .x = 3, .y = -7 });
+	  obstacles.clear();
+	  obstacles.add({ .x = -7, .y = 3 });
+
+	  THEN("only obstacles added after clear remain")
+	  {
+		REQUIRE(obstacles.size() == 1);
+		REQUIRE(obstacles.contains({ .x = -7, .y = 3 }));
+		REQUIRE_FALSE(obstacles.contains({ .x = 3, .y = -7 }));
+	  }
+	}
+  }
+}
+
+SCENARIO("Obstacle map - unlimited planet")
+{
+  GIVEN("Obstacle map for unlimited planet")
+  {
+	ObstacleMap obstacles(Limited2dPlane{});
+
+	WHEN("Distant obstacles are added")
+	{
+	  obstacles.add({ .x = -1'000'000, .y = 2'000'000 });
+	  obstacles.add({ .x = 2'000'000, .y = -1'000'000 });
+
+	  THEN("only those squares contain obstacles")
+	  {
+		REQUIRE(obstacles.size() == 2);
+		REQUIRE(obstacles.contains({ .x = -1'000'000, .y = 2'000'000 }));
+		REQUIRE_FALSE(obstacles.contains({ .x = 2'000'000, .y = 1'000'000 }));
+	  }
+	}
+
+	WHEN("Obstacle is added beyond 32-bit coordinates")
+	{
+	  obstacles.add({ .x = 0x1'0000'0005, .y = 7 });
+
+	  THEN("squares with the same low 32 bits are free")
+	  {
+		REQUIRE(obstacles.contains(0x1'0000'0005, 7));
+		REQUIRE_FALSE(obstacles.contains(5, 7));
+		REQUIRE_FALSE(obstacles.contains(0x1'0000'0005, 0x1'0000'0007));
+	  }
+	}
+  }
+}
+
+using CommandAndResult = std::tuple<std::string, Coordinates, std::optional<Location>>;
+
+SCENARIO("Rover - obstacle detection")
+{
+  const Limited2dPlane limit{ .x_min = -10, .y_min = -10, .x_max = 10, .y_max = 10 };
+
+  auto plane = GENERATE_COPY(Limited2dPlane{}, limit);
+  auto [command_sequence, expected_coords, expected_obstacle] = GENERATE(
+	CommandAndResult{ "FFFFF", Coordinates{ .x = 0, .y = 2, .direction = Direction::N }, Location{ .x = 0, .y = 3 } },
+	CommandAndResult{ "RFFLFFFFF", Coordinates{ .x = 2, .y = 5, .direction = Direction::N }, std::nullopt },
+	CommandAndResult{ "RBBBBLFFRFFF", Coordinates{ .x = -4, .y = 2, .direction = Direction::E }, Location{ .x = -3, .y = 2 } });
+
+  GIVEN("Rover on planet " << plane << " with obstacles")
+  {
+	auto obstacles = std::make_shared<ObstacleMap>(plane);
+	obstacles->add({ .x = 0, .y = 3 });
+	obstacles->add({ .x = -3, .y = 2 });
+
+	Rover rover({ .x = 0, .y = 0, .direction = Direction::N }, plane, obstacles);
+
+	WHEN("Command sequence is requested: " << command_sequence)
+	{
+	  auto obstacle = rover.runCommandSequence(command_sequence);
+
+	  THEN("Rover stops at last possible point and reports obstacle")
+	  {
+		REQUIRE(rover.getPosition() == expected_coords);
+		REQUIRE(obstacle == expected_obstacle);
+	  }
+	}
+
+	WHEN("Compiled program is requested: " << command_sequence)
+	{
+	  auto obstacle = rover.runProgram(CommandProgram::compile(command_sequence));
+
+	  THEN("Rover stops at last possible point and reports obstacle")
+	  {
+		REQUIRE(rover.getPosition() == expected_coords);
+		REQUIRE(obstacle == expected_obstacle);
+	  }
+	}
+  }
+}
+
+SCENARIO("Rover - obstacle behind planet edge")
+{
+  const Limited2dPlane limit{ .x_min = -10, .y_min = -10, .x_max = 10, .y_max = 10 };
+
+  GIVEN("Rover at the edge of planet with obstacle on the opposite edge")
+  {
+	auto obstacles = std::make_shared<ObstacleMap>(limit);
+	obstacles->add({ .x = -10, .y = 0 });
+
+	Rover rover({ .x = 10, .y = 0, .direction = Direction::E }, limit, obstacles);
+
+	WHEN("Moved forward")
+	{
+	  bool moved = rover.moveForward();
+
+	  THEN("Rover does not move")
+	  {
+		REQUIRE_FALSE(moved);
+		REQUIRE(rover.getPosition() == Coordinates{ .x = 10, .y = 0, .direction = Direction::E });
+	  }
+	}
+  }
+}
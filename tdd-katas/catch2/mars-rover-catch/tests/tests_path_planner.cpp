@@ -0,0 +1,150 @@
+#include "path_planner.hpp"
+#include "rover_io.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <optional>
+#include <string>
+
+using namespace std;
+using namespace TDD;
+
+namespace
+{
+  const Limited2dPlane planet{ .x_min = 0, .y_min = 0, .x_max = 9, .y_max = 9 };
+
+  // runs program on a rover and returns the position it stops at
+  Coordinates follow(const string& program, const Coordinates& start, shared_ptr<const ObstacleMap> obstacles)
+  {
+	Rover rover(start, planet, std::move(obstacles));
+	REQUIRE_FALSE(rover.runCommandSequence(program).has_value());
+	return rover.getPosition();
+  }
+}
+
+SCENARIO("Path planning on empty planet")
+{
+  GIVEN("Planner and rover at 2,2 facing north on planet 10x10")
+  {
+	PathPlanner planner;
+	const auto obstacles = make_shared<const ObstacleMap>(planet);
+	const Coordinates start{ .x = 2, .y = 2, .direction = Direction::N };
+
+	WHEN("Target is the start square")
+	{
+	  THEN("program is empty")
+	  {
+		REQUIRE(planner.plan(start, { .x = 2, .y = 2 }, planet, *obstacles) == "");
+	  }
+	}
+
+	WHEN("Target lies ahead or behind")
+	{
+	  THEN("rover only moves forward or backward")
+	  {
+		REQUIRE(planner.plan(start, { .x = 2, .y = 5 }, planet, *obstacles) == "FFF");
+		REQUIRE(planner.plan(start, { .x = 2, .y = 0 }, planet, *obstacles) == "BB");
+	  }
+	}
+
+	WHEN("Target is closer across the planet edge")
+	{
+	  THEN("program wraps around the planet")
+	  {
+		REQUIRE(planner.plan(start, { .x = 2, .y = 9 }, planet, *obstacles) == "BBB");
+	  }
+	}
+
+	WHEN("Target needs a turn")
+	{
+	  const auto program = planner.plan(start, { .x = 5, .y = 4 }, planet, *obstacles);
+
+	  THEN("program has one turn and reaches the target")
+	  {
+		REQUIRE(program.has_value());
+		REQUIRE(program->size() == 6);
+		const Coordinates end = follow(*program, start, obstacles);
+		REQUIRE(end.x == 5);
+		REQUIRE(end.y == 4);
+	  }
+	}
+  }
+}
+
+SCENARIO("Path planning around obstacles")
+{
+  GIVEN("Wall at y = 4 from x = 0 to x = 8 on planet 10x10")
+  {
+	PathPlanner planner;
+	auto obstacles = make_shared<ObstacleMap>(planet);
+	for (int x = 0; x <= 8; ++x)
+	  obstacles->add({ .x = static_cast<double>(x), .y = 4 });
+
+	const Coordinates start{ .x = 2, .y = 2, .direction = Direction::N };
+
+	WHEN("Target lies behind the wall")
+	{
+	  const auto program = planner.plan(start, { .x = 2, .y = 6 }, planet, *obstacles);
+
+	  THEN("rover goes around the wall without hitting obstacles")
+	  {
+		REQUIRE(program.has_value());
+		REQUIRE(program == "BBBBBB"); // through the planet edge, not the gap in the wall
+		const Coordinates end = follow(*program, start, obstacles);
+		REQUIRE(end.x == 2);
+		REQUIRE(end.y == 6);
+	  }
+	}
+
+	WHEN("Wall closes the planet and the edge")
+	{
+	  obstacles->add({ .x = 9, .y = 4 });
+	  for (int x = 0; x <= 9; ++x)
+		obstacles->add({ .x = static_cast<double>(x), .y = 8 });
+
+	  THEN("target behind the wall is unreachable")
+	  {
+		REQUIRE_FALSE(planner.plan(start, { .x = 2, .y = 6 }, planet, *obstacles).has_value());
+	  }
+	}
+
+	WHEN("Target is an obstacle")
+	{
+	  THEN("target is unreachable")
+	  {
+		REQUIRE_FALSE(planner.plan(start, { .x = 3, .y = 4 }, planet, *obstacles).has_value());
+	  }
+	}
+
+	WHEN("Planner is reused for other queries")
+	{
+	  const auto first = planner.plan(start, { .x = 2, .y = 6 }, planet, *obstacles);
+	  const auto second = planner.plan(start, { .x = 9, .y = 5 }, planet, *obstacles);
+	  const auto third = planner.plan(start, { .x = 2, .y = 6 }, planet, *obstacles);
+
+	  THEN("results do not depend on previous searches")
+	  {
+		REQUIRE(second.has_value());
+		REQUIRE(first == third);
+	  }
+	}
+  }
+}
+
+SCENARIO("Path planning input validation")
+{
+  PathPlanner planner;
+  const ObstacleMap obstacles;
+  const Coordinates start{ .x = 0, .y = 0, .direction = Direction::N };
+
+  THEN("unlimited planet is rejected")
+  {
+	REQUIRE_THROWS_AS(planner.plan(start, { .x = 1, .y = 1 }, Limited2dPlane{}, obstacles), std::invalid_argument);
+  }
+
+  THEN("positions outside of planet are rejected")
+  {
+	REQUIRE_THROWS_AS(planner.plan(start, { .x = 10, .y = 1 }, planet, obstacles), std::out_of_range);
+	REQUIRE_THROWS_AS(planner.plan({ .x = -1, .y = 0 }, { .x = 1, .y = 1 }, planet, obstacles), std::out_of_range);
+  }
+}
@@ -0,0 +1,173 @@
+#include "rover_fleet.hpp"
+#include "rover_io.hpp"
+#include "work_stealing_pool.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_all.hpp>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace TDD;
+
+namespace
+{
+  const Limited2dPlane fleet_planet_limit{ .x_min = -10, .y_min = -10, .x_max = 10, .y_max = 10 };
+
+  std::vector<Coordinates> fleet_start_positions(size_t count)
+  {
+	std::vector<Coordinates> positions;
+
+	for (size_t i = 0; i < count; ++i)
+	  positions.push_back({ .x = double(i % 21) - 10, .y = double(i % 7), .direction = static_cast<Direction>(i % 4) });
+
+	return positions;
+  }
+}
+
+SCENARIO("Rover fleet - same command for every rover")
+{
+  auto rovers_count = GENERATE(size_t{ 5 }, size_t{ 3 * RoverFleet::min_rovers_per_thread + 17 });
+
+  GIVEN("Fleet of " << rovers_count << " rovers")
+  {
+	const auto positions = fleet_start_positions(rovers_count);
+	RoverFleet fleet(fleet_planet_limit, 4);
+	for (const auto& position : positions)
+	  fleet.add(position);
+
+	WHEN("Command sequence is sent to the whole fleet")
+	{
+	  const std::string sequence = "FFRFFFFFFFFFFFFLBBBBBBBBBBBBBBBL";
+	  for (char command : sequence)
+		fleet.runCommand(command);
+
+	  THEN("every rover is at the same position as a single rover")
+	  {
+		for (size_t i = 0; i < rovers_count; ++i)
+		{
+		  Rover rover(positions[i], fleet_planet_limit);
+		  rover.runCommandSequence(sequence);
+
+		  REQUIRE(fleet.getPosition(i) == rover.getPosition());
+		}
+	  }
+	}
+
+	WHEN("Unsupported command is sent")
+	{
+	  THEN("Should throw exception")
+	  {
+		REQUIRE_THROWS_AS(fleet.runCommand('x'), NotSupportedCommandException);
+	  }
+	}
+  }
+}
+
+SCENARIO("Rover fleet - command stream per rover")
+{
+  GIVEN("Fleet with a command stream for every rover")
+  {
+	const size_t rovers_count = 2 * RoverFleet::min_rovers_per_thread + 3;
+	const auto positions = fleet_start_positions(rovers_count);
+	const std::vector<std::string> sequences = { "FFFFFFFFFFFFFFFFFFFFFFFFFFR", "LLBBBBBBBBBBBBBBBBBBBBBB", "", "RFRFRFRFLLB" };
+
+	RoverFleet fleet(fleet_planet_limit, 3);
+	std::vector<std::string_view> streams;
+	for (size_t i = 0; i < rovers_count; ++i)
+	{
+	  fleet.add(positions[i]);
+	  streams.push_back(sequences[i % sequences.size()]);
+	}
+
+	WHEN("Streams are run")
+	{
+	  fleet.runCommandStreams(streams);
+
+	  THEN("every rover is at the same position as a single rover")
+	  {
+		for (size_t i = 0; i < rovers_count; ++i)
+		{
+		  Rover rover(positions[i], fleet_planet_limit);
+		  rover.runCommandSequence(streams[i]);
+
+		  REQUIRE(fleet.getPosition(i) == rover.getPosition());
+		}
+	  }
+	}
+
+	WHEN("One of streams contains unsupported command")
+	{
+	  streams.back() = "FFx";
+
+	  THEN("Should throw exception before any rover moves")
+	  {
+		REQUIRE_THROWS_AS(fleet.runCommandStreams(streams), NotSupportedCommandException);
+		REQUIRE(fleet.getPosition(0) == positions[0]);
+	  }
+	}
+  }
+}
+
+SCENARIO("Rover fleet - rover view of fleet slot")
+{
+  GIVEN("Fleet with two rovers")
+  {
+	RoverFleet fleet(fleet_planet_limit);
+	fleet.add({ .x = 0, .y = 10, .direction = Direction::N });
+	fleet.add({ .x = 5, .y = 5, .direction = Direction::E });
+
+	WHEN("Second rover is driven through its view")
+	{
+	  FleetRover rover = fleet.rover(1);
+	  const auto obstacle = rover.runCommandSequence("FFFFFFL");
+
+	  THEN("only its slot changes")
+	  {
+		REQUIRE_FALSE(obstacle.has_value());
+		REQUIRE(rover.getPosition() == Coordinates{ .x = -10, .y = 5, .direction = Direction::N });
+		REQUIRE(fleet.getPosition(0) == Coordinates{ .x = 0, .y = 10, .direction = Direction::N });
+	  }
+	}
+
+	WHEN("Rover is moved like a single Rover")
+	{
+	  FleetRover rover = fleet.rover(0);
+
+	  THEN("moves report no obstacle")
+	  {
+		REQUIRE(rover.moveForward());
+		REQUIRE(rover.moveBackward());
+		REQUIRE(rover.runCommand('R'));
+		REQUIRE(rover.getPosition() == Coordinates{ .x = 0, .y = 10, .direction = Direction::E });
+	  }
+	}
+  }
+}
+
+SCENARIO("Work stealing pool - task exception")
+{
+  GIVEN("Pool of 3 threads")
+  {
+	WorkStealingPool pool(3);
+	std::atomic<size_t> tasks_run{ 0 };
+
+	WHEN("One of tasks throws")
+	{
+	  THEN("exception is rethrown after all other tasks are done and pool can run again")
+	  {
+		REQUIRE_THROWS_AS(pool.run(100, [&](unsigned, size_t task) {
+		  if (task == 7)
+			throw std::runtime_error("task failed");
+		  ++tasks_run;
+		}), std::runtime_error);
+		REQUIRE(tasks_run == 99);
+
+		pool.run(100, [&](unsigned, size_t) { ++tasks_run; });
+		REQUIRE(tasks_run == 199);
+	  }
+	}
+  }
+}
@@ -0,0 +1,203 @@
+#include "rover.hpp"
+#include "telemetry_io.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace TDD;
+
+SCENARIO("Telemetry ring buffer")
+{
+  GIVEN("Ring for 4 records")
+  {
+	TelemetryRing ring(3);
+
+	THEN("capacity is rounded up to power of two")
+	{
+	  REQUIRE(ring.capacity() == 4);
+	}
+
+	WHEN("More records are pushed than fit")
+	{
+	  for (int32_t x = 0; x < 6; ++x)
+		ring.push({ .x = x, .y = 0, .command = 'F', .direction = Direction::E });
+
+	  THEN("oldest records are kept and the rest are counted as dropped")
+	  {
+		vector<int32_t> xs;
+		REQUIRE(ring.drain([&](const TelemetryRecord& record) { xs.push_back(record.x); }) == 4);
+		REQUIRE(xs == vector<int32_t>{ 0, 1, 2, 3 });
+		REQUIRE(ring.dropped() == 2);
+	  }
+	}
+
+	WHEN("Records are pushed and popped across the end of the ring")
+	{
+	  TelemetryRecord record;
+	  for (int32_t x = 0; x < 10; ++x)
+	  {
+		REQUIRE(ring.push({ .x = x, .y = -x, .command = 'B', .direction = Direction::S }));
+		REQUIRE(ring.pop(record));
+		REQUIRE(record == TelemetryRecord{ .x = x, .y = -x, .command = 'B', .direction = Direction::S });
+	  }
+
+	  THEN("ring ends empty")
+	  {
+		REQUIRE_FALSE(ring.pop(record));
+		REQUIRE(ring.dropped() == 0);
+	  }
+	}
+  }
+
+  GIVEN("Producer and consumer threads")
+  {
+	TelemetryRing ring(64);
+	constexpr int32_t records_count = 10'000;
+
+	WHEN("Producer pushes until every record is accepted")
+	{
+	  jthread producer([&] {
+		for (int32_t x = 0; x < records_count; ++x)
+		{
+		  while (!ring.push({ .x = x, .y = 0, .command = 'F', .direction = Direction::N }))
+			this_thread::yield();
+		}
+	  });
+
+	  int32_t expected = 0;
+	  bool in_order = true;
+	  while (expected < records_count)
+	  {
+		ring.drain([&](const TelemetryRecord& record) { in_order = in_order && record.x == expected++; });
+	  }
+
+	  THEN("consumer receives all records in order")
+	  {
+		REQUIRE(in_order);
+	  }
+	}
+  }
+}
+
+SCENARIO("Telemetry dump")
+{
+  GIVEN("Dumped trajectory")
+  {
+	const Coordinates start{ .x = 1, .y = 2, .direction = Direction::W };
+	const Limited2dPlane planet{ .x_min = 0, .y_min = 0, .x_max = 9, .y_max = 9 };
+	const vector<TelemetryRecord> records{
+	  { .x = 0, .y = 2, .command = 'F', .direction = Direction::W },
+	  { .x = 0, .y = 2, .command = 'R', .direction = Direction::N },
+	};
+
+	stringstream stream;
+	Telemetry::dump(stream, start, planet, records);
+
+	WHEN("Dump is loaded")
+	{
+	  vector<TelemetryRecord> loaded;
+	  const Telemetry::Header header = Telemetry::load(stream, loaded);
+
+	  THEN("start, planet and records are restored")
+	  {
+		REQUIRE(header.start == start);
+		REQUIRE(header.planet_limit == planet);
+		REQUIRE(loaded == records);
+	  }
+	}
+
+	WHEN("Same trajectory is dumped again")
+	{
+	  stringstream again;
+	  Telemetry::dump(again, start, planet, records);
+
+	  THEN("dump has fixed size and the same bytes")
+	  {
+		REQUIRE(again.str().size() == 8 + Telemetry::HEADER_SIZE + records.size() * Telemetry::RECORD_SIZE);
+		REQUIRE(again.str() == stream.str());
+		REQUIRE(again.str().substr(8 + 2 * sizeof(double) + 1, 7) == string(7, '\0'));
+	  }
+	}
+
+	WHEN("Dump with corrupted records count is loaded")
+	{
+	  string data = stream.str();
+	  const uint64_t records_count = UINT64_MAX / 2;
+	  std::memcpy(data.data() + 8 + Telemetry::HEADER_SIZE - sizeof(records_count), &records_count, sizeof(records_count));
+	  istringstream corrupted(data);
+	  vector<TelemetryRecord> loaded;
+
+	  THEN("Should throw exception without allocating")
+	  {
+		REQUIRE_THROWS_AS(Telemetry::load(corrupted, loaded), std::runtime_error);
+	  }
+	}
+
+	WHEN("Truncated dump is loaded")
+	{
+	  string data = stream.str();
+	  data.pop_back();
+	  istringstream truncated(data);
+	  vector<TelemetryRecord> loaded;
+
+	  THEN("Should throw exception")
+	  {
+		REQUIRE_THROWS_AS(Telemetry::load(truncated, loaded), std::runtime_error);
+	  }
+	}
+  }
+
+  GIVEN("Data which is not a dump")
+  {
+	istringstream stream("mars rover");
+	vector<TelemetryRecord> loaded;
+
+	THEN("Should throw exception")
+	{
+	  REQUIRE_THROWS_AS(Telemetry::load(stream, loaded), std::runtime_error);
+	}
+  }
+}
+
+#if ROVER_TELEMETRY
+SCENARIO("Rover telemetry")
+{
+  GIVEN("Rover with telemetry on planet 5x5")
+  {
+	TelemetryRing ring(64);
+	Rover rover({ .x = 0, .y = 0, .direction = Direction::N }, { .x_min = 0, .y_min = 0, .x_max = 4, .y_max = 4 });
+	rover.attachTelemetry(&ring);
+
+	WHEN("Commands and compiled program are executed")
+	{
+	  rover.runCommandSequence("FR");
+	  rover.runProgram(CommandProgram::compile("BBRR"));
+
+	  THEN("every command is recorded with position after it")
+	  {
+		vector<TelemetryRecord> records;
+		ring.drain([&](const TelemetryRecord& record) { records.push_back(record); });
+
+		REQUIRE(records == vector<TelemetryRecord>{
+		  { .x = 0, .y = 1, .command = 'F', .direction = Direction::N },
+		  { .x = 0, .y = 1, .command = 'R', .direction = Direction::E },
+		  { .x = 4, .y = 1, .command = 'B', .direction = Direction::E },
+		  { .x = 3, .y = 1, .command = 'B', .direction = Direction::E },
+		  { .x = 3, .y = 1, .command = 'R', .direction = Direction::S },
+		  { .x = 3, .y = 1, .command = 'R', .direction = Direction::W },
+		});
+	  }
+	}
+  }
+}
+#else
+// wrap bounds are four doubles, grid bounds and grid square are six int64_t
+static_assert(sizeof(Rover) == sizeof(Coordinates) + 4 * sizeof(double) + 6 * sizeof(int64_t) + sizeof(std::shared_ptr<const ObstacleMap>),
+              "telemetry compiled out must not change Rover");
+#endif
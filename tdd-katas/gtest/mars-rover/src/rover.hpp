@@ -1,11 +0,0 @@
-#ifndef ROVER_HPP
-#define ROVER_HPP
-
-#include <vector>
-#include <string>
-#include <algorithm>
-
-namespace TDD
-{}
-
-#endif
\ No newline at end of file
@@ -5,11 +5,123 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include "grid_rover.hpp"
 #include "rover.hpp"
+#include "rover_io.hpp"
 
 using namespace std;
+using namespace TDD;
 
-TEST(RoverTests, FirstTest)
+constexpr Coordinates start_coordinates{ .x = 0, .y = 0, .direction = Direction::N };
+const Limited2dPlane planet_limit{ .x_min = -100, .y_min = -100, .x_max = 100, .y_max = 100 };
+
+// engine is constexpr-capable: programs compile and grid rovers drive at compile time
+static_assert(CommandProgram::compile("FFFRRBB").instructions().size() == 2);
+static_assert(Limited2dPlane{}.isUnlimited());
+static_assert([] {
+    GridRover<int32_t, LimitedGrid<int32_t>> rover({ .x = 0, .y = 0, .direction = Direction::N }, LimitedGrid<int32_t>(-1, -1, 1, 1));
+    rover.runCommandSequence("FFRF");
+    return rover.getPosition() == GridCoordinates<int32_t>{ .x = 1, .y = -1, .direction = Direction::E };
+}());
+
+TEST(RoverTests, WhenCreated_PositionIsStartCoordinates)
+{
+    Rover rover(start_coordinates);
+
+    ASSERT_EQ(rover.getPosition(), start_coordinates);
+}
+
+struct MoveParams
+{
+    const char* test_description;
+    Coordinates start;
+    char command;
+    Coordinates expected;
+};
+
+std::ostream& operator<<(std::ostream& out, const MoveParams& params)
+{
+    out << params.test_description;
+    return out;
+}
+
+struct RoverMoveTests : ::testing::TestWithParam<MoveParams>
 {
-    EXPECT_EQ(1, 1);
-}
\ No newline at end of file
+};
+
+TEST_P(RoverMoveTests, SingleCommand)
+{
+    const MoveParams param = GetParam();
+    Rover rover(param.start);
+
+    rover.runCommand(param.command);
+
+    ASSERT_EQ(rover.getPosition(), param.expected);
+}
+
+MoveParams move_params[] = {
+    { "forward facing N", { .x = 5, .y = 5, .direction = Direction::N }, 'F', { .x = 5, .y = 6, .direction = Direction::N } },
+    { "forward facing E", { .x = 4, .y = -10, .direction = Direction::E }, 'F', { .x = 5, .y = -10, .direction = Direction::E } },
+    { "forward facing S", { .x = -5, .y = 10, .direction = Direction::S }, 'F', { .x = -5, .y = 9, .direction = Direction::S } },
+    { "forward facing W", { .x = -10, .y = 2, .direction = Direction::W }, 'F', { .x = -11, .y = 2, .direction = Direction::W } },
+    { "backward facing N", { .x = 5, .y = 5, .direction = Direction::N }, 'B', { .x = 5, .y = 4, .direction = Direction::N } },
+    { "backward facing W", { .x = -10, .y = 2, .direction = Direction::W }, 'B', { .x = -9, .y = 2, .direction = Direction::W } },
+    { "right from N", { .direction = Direction::N }, 'R', { .direction = Direction::E } },
+    { "right from W", { .direction = Direction::W }, 'R', { .direction = Direction::N } },
+    { "left from N", { .direction = Direction::N }, 'L', { .direction = Direction::W } },
+    { "left from S", { .direction = Direction::S }, 'L', { .direction = Direction::E } },
+};
+
+INSTANTIATE_TEST_SUITE_P(PackOfMoveTests, RoverMoveTests, ::testing::ValuesIn(move_params));
+
+TEST(RoverTests, WhenDrivesOverPlanetLimit_WrapsToOppositeLimit)
+{
+    Rover rover({ .x = 1, .y = 100, .direction = Direction::N }, planet_limit);
+
+    rover.moveForward();
+    ASSERT_EQ(rover.getPosition(), (Coordinates{ .x = 1, .y = -100, .direction = Direction::N }));
+
+    rover.moveBackward();
+    ASSERT_EQ(rover.getPosition(), (Coordinates{ .x = 1, .y = 100, .direction = Direction::N }));
+}
+
+TEST(RoverTests, WhenCommandSequence_AllCommandsAreExecuted)
+{
+    Rover rover(start_coordinates);
+
+    rover.runCommandSequence("FFFFFL");
+
+    ASSERT_EQ(rover.getPosition(), (Coordinates{ .x = 0, .y = 5, .direction = Direction::W }));
+}
+
+TEST(RoverTests, WhenUnsupportedCommand_ThrowsException)
+{
+    Rover rover(start_coordinates);
+
+    ASSERT_THROW(rover.runCommandSequence("LLFxM12c 986."), NotSupportedCommandException);
+}
+
+TEST(RoverTests, WhenObstacleAhead_SequenceIsAbortedAndObstacleReported)
+{
+    auto obstacles = make_shared<ObstacleMap>(planet_limit);
+    obstacles->add({ .x = 0, .y = 3 });
+    Rover rover(start_coordinates, planet_limit, obstacles);
+
+    const auto obstacle = rover.runCommandSequence("FFFFRF");
+
+    ASSERT_EQ(obstacle, (Location{ .x = 0, .y = 3 }));
+    ASSERT_EQ(rover.getPosition(), (Coordinates{ .x = 0, .y = 2, .direction = Direction::N }));
+}
+
+TEST(RoverTests, WhenCompiledProgramIsRun_PositionIsSameAsAfterCommandSequence)
+{
+    const string command_sequence = "RRRRRFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFLLLLLLBBBBBBBBBBBBBBBBBBBBBB";
+
+    Rover rover(start_coordinates, planet_limit);
+    rover.runProgram(CommandProgram::compile(command_sequence));
+
+    Rover interpreting_rover(start_coordinates, planet_limit);
+    interpreting_rover.runCommandSequence(command_sequence);
+
+    ASSERT_EQ(rover.getPosition(), interpreting_rover.getPosition());
+}
@@ -0,0 +1,49 @@
+#ifndef COORDINATES_HPP
+#define COORDINATES_HPP
+
+#include <cmath>
+#include <cstdint>
+
+namespace TDD
+{
+  enum struct Direction : uint8_t
+  {
+	N = 0,
+	E,
+	S,
+	W
+  };
+
+  struct Coordinates
+  {
+	double x{}, y{};
+	Direction direction{ Direction::N };
+
+	bool operator==(const Coordinates& other) const = default;
+  };
+
+  struct Limited2dPlane
+  {
+	double x_min = NAN;
+	double y_min = NAN;
+	double x_max = NAN;
+	double y_max = NAN;
+
+	// NaN is the only value not equal to itself - constexpr unlike std::isnan
+	[[nodiscard]] constexpr bool isUnlimited() const
+	{
+	  return x_min != x_min && y_min != y_min && x_max != x_max && y_max != y_max;
+	}
+
+	bool operator==(const Limited2dPlane&) const = default;
+  };
+
+  struct Location
+  {
+	double x{}, y{};
+
+	bool operator==(const Location& other) const = default;
+  };
+}
+
+#endif
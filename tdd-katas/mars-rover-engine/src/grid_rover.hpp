@@ -0,0 +1,191 @@
+#ifndef GRID_ROVER_HPP
+#define GRID_ROVER_HPP
+
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+
+#include "rover.hpp"
+
+namespace TDD
+{
+  template <std::signed_integral T>
+  struct GridCoordinates
+  {
+	T x{}, y{};
+	Direction direction{ Direction::N };
+
+	bool operator==(const GridCoordinates& other) const = default;
+  };
+
+  namespace Details
+  {
+	constexpr std::array<int8_t, 4> grid_delta_x{ 0, 1, 0, -1 };
+	constexpr std::array<int8_t, 4> grid_delta_y{ 1, 0, -1, 0 };
+
+	// adds or subtracts size with a mask when value leaves [min, max] by less than size - no branches
+	template <std::signed_integral T>
+	constexpr T wrap_around(T value, T min, T max, T size)
+	{
+	  value += size & -static_cast<T>(value < min);
+	  value -= size & -static_cast<T>(value > max);
+	  return value;
+	}
+  }
+
+  // planet topology policies for GridRover
+  // - move(position, step) moves position by step squares: +1 forward, -1 backward, 0 stays in place
+
+  template <std::signed_integral T>
+  struct UnlimitedGrid
+  {
+	static constexpr void move(GridCoordinates<T>& position, int step)
+	{
+	  const auto direction = static_cast<size_t>(position.direction);
+
+	  position.x = static_cast<T>(position.x + step * Details::grid_delta_x[direction]);
+	  position.y = static_cast<T>(position.y + step * Details::grid_delta_y[direction]);
+	}
+  };
+
+  // flat torus of squares [x_min, x_max] x [y_min, y_max]
+  template <std::signed_integral T>
+  class LimitedGrid
+  {
+  public:
+	constexpr LimitedGrid(T x_min, T y_min, T x_max, T y_max)
+	  : x_min(x_min), y_min(y_min), x_max(x_max), y_max(y_max), width(x_max - x_min + 1), height(y_max - y_min + 1)
+	{}
+
+	constexpr void move(GridCoordinates<T>& position, int step) const
+	{
+	  const auto direction = static_cast<size_t>(position.direction);
+
+	  position.x = Details::wrap_around(static_cast<T>(position.x + step * Details::grid_delta_x[direction]), x_min, x_max, width);
+	  position.y = Details::wrap_around(static_cast<T>(position.y + step * Details::grid_delta_y[direction]), y_min, y_max, height);
+	}
+
+  private:
+	T x_min, y_min, x_max, y_max;
+	T width, height;
+  };
+
+  // sphere mapped to longitude x in [0, longitudes) and latitude y in [0, latitudes) - row 0 touches the south pole
+  // - crossing a pole keeps the latitude row, shifts longitude by 180 degrees and flips N <-> S
+  // - transitions are precomputed for every direction of motion, so a move costs the same as on the torus
+  template <std::signed_integral T>
+  class SphericalGrid
+  {
+  public:
+	constexpr SphericalGrid(T longitudes, T latitudes)
+	  : longitudes(longitudes), half_turn(static_cast<T>(longitudes / 2))
+	{
+	  if (longitudes <= 0 || longitudes % 2 != 0 || latitudes <= 0)
+		throw std::invalid_argument("sphere needs even number of longitudes and positive number of latitudes");
+
+	  constexpr T no_pole = -1;
+	  transitions[static_cast<size_t>(Direction::N)] = { .delta_x = 0, .delta_y = 1, .pole_row = static_cast<T>(latitudes - 1) };
+	  transitions[static_cast<size_t>(Direction::E)] = { .delta_x = 1, .delta_y = 0, .pole_row = no_pole };
+	  transitions[static_cast<size_t>(Direction::S)] = { .delta_x = 0, .delta_y = -1, .pole_row = 0 };
+	  transitions[static_cast<size_t>(Direction::W)] = { .delta_x = -1, .delta_y = 0, .pole_row = no_pole };
+	}
+
+	constexpr void move(GridCoordinates<T>& position, int step) const
+	{
+	  // moving backward is moving forward in the opposite direction
+	  const size_t motion = (static_cast<size_t>(position.direction) + (step < 0 ? 2u : 0u)) & 3u;
+	  const Transition& transition = transitions[motion];
+
+	  const T moves = -static_cast<T>(step != 0); // all bits set when rover moves
+	  const T crosses_pole = -static_cast<T>(position.y == transition.pole_row) & moves;
+
+	  const T delta_x = static_cast<T>((transition.delta_x + (half_turn & crosses_pole)) & moves);
+	  const T delta_y = static_cast<T>(transition.delta_y & ~crosses_pole & moves);
+
+	  position.x = Details::wrap_around(static_cast<T>(position.x + delta_x), T{ 0 }, static_cast<T>(longitudes - 1), longitudes);
+	  position.y = static_cast<T>(position.y + delta_y);
+	  position.direction = static_cast<Direction>(static_cast<unsigned>(position.direction) ^ (2u & static_cast<unsigned>(crosses_pole)));
+	}
+
+  private:
+	struct Transition
+	{
+	  T delta_x, delta_y;
+	  T pole_row;
+	};
+
+	T longitudes;
+	T half_turn;
+	std::array<Transition, 4> transitions{};
+  };
+
+  // rover on integer grid - planet topology is a compile time policy, so the hot loop has no floating point
+  // compares and no checks for unlimited plane
+  template <std::signed_integral T = int32_t, typename Planet = UnlimitedGrid<T>>
+  class GridRover
+  {
+  public:
+	using Position = GridCoordinates<T>;
+
+	explicit constexpr GridRover(const Position& initial_position, const Planet& planet = {})
+	  : current_position(initial_position), planet(planet)
+	{}
+
+	constexpr Position getPosition() const
+	{
+	  return current_position;
+	}
+
+	constexpr void moveForward()
+	{
+	  planet.move(current_position, 1);
+	}
+
+	constexpr void moveBackward()
+	{
+	  planet.move(current_position, -1);
+	}
+
+	constexpr void turnRight()
+	{
+	  turn(1);
+	}
+
+	constexpr void turnLeft()
+	{
+	  turn(3);
+	}
+
+	constexpr void runCommandSequence(std::string_view sequence)
+	{
+	  for (char command : sequence)
+	  {
+		runCommand(command);
+	  }
+	}
+
+	constexpr void runCommand(char command)
+	{
+	  const Details::CommandStep& step = Details::command_steps[static_cast<unsigned char>(command)];
+
+	  if (!step.is_supported)
+		throw NotSupportedCommandException();
+
+	  planet.move(current_position, step.move);
+	  turn(step.turn);
+	}
+
+  private:
+	Position current_position;
+	[[no_unique_address]] Planet planet;
+
+	constexpr void turn(unsigned quarter_turns)
+	{
+	  current_position.direction = static_cast<Direction>((static_cast<unsigned>(current_position.direction) + quarter_turns) & 3u);
+	}
+  };
+}
+
+#endif
@@ -0,0 +1,132 @@
+#ifndef OBSTACLE_MAP_HPP
+#define OBSTACLE_MAP_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <unordered_set>
+#include <vector>
+
+#include "coordinates.hpp"
+
+namespace TDD
+{
+  // obstacles on integer grid cells
+  // - limited planet: packed bitset with one bit per cell (10^8 cells take ~12 MB)
+  // - unlimited planet: sparse hash set of cells
+  class ObstacleMap
+  {
+  public:
+	ObstacleMap() = default;
+
+	// planet_limit must have all limits set (bitset grid) or none of them (sparse set)
+	explicit ObstacleMap(const Limited2dPlane& planet_limit)
+	{
+	  if (planet_limit.isUnlimited())
+		return;
+
+	  if (!(planet_limit.x_min <= planet_limit.x_max && planet_limit.y_min <= planet_limit.y_max))
+		throw std::invalid_argument("invalid planet limit");
+
+	  is_grid = true;
+	  x_min = std::llround(planet_limit.x_min);
+	  y_min = std::llround(planet_limit.y_min);
+	  width = static_cast<uint64_t>(std::llround(planet_limit.x_max) - x_min + 1);
+	  height = static_cast<uint64_t>(std::llround(planet_limit.y_max) - y_min + 1);
+	  grid.resize((width * height + 63) / 64);
+	}
+
+	void add(const Location& location)
+	{
+	  if (is_grid)
+	  {
+		const uint64_t cell = gridCell(std::llround(location.x), std::llround(location.y));
+		if (cell == outside_grid)
+		  throw std::out_of_range("obstacle outside of planet");
+
+		const uint64_t mask = uint64_t{ 1 } << (cell % 64);
+		obstacles_count += (grid[cell / 64] & mask) == 0;
+		grid[cell / 64] |= mask;
+	  }
+	  else
+	  {
+		sparse.insert(Cell{ std::llround(location.x), std::llround(location.y) });
+		obstacles_count = sparse.size();
+	  }
+	}
+
+	bool contains(const Location& location) const
+	{
+	  return contains(std::llround(location.x), std::llround(location.y));
+	}
+
+	bool contains(int64_t x, int64_t y) const
+	{
+	  if (is_grid)
+	  {
+		const uint64_t cell = gridCell(x, y);
+		return cell != outside_grid && (grid[cell / 64] >> (cell % 64)) & 1u;
+	  }
+
+	  return !sparse.empty() && sparse.contains(Cell{ x, y });
+	}
+
+	// removes all obstacles and keeps the memory for reuse
+	void clear()
+	{
+	  std::fill(grid.begin(), grid.end(), 0);
+	  sparse.clear();
+	  obstacles_count = 0;
+	}
+
+	size_t size() const
+	{
+	  return obstacles_count;
+	}
+
+	bool empty() const
+	{
+	  return obstacles_count == 0;
+	}
+
+  private:
+	static constexpr uint64_t outside_grid = ~uint64_t{ 0 };
+
+	struct Cell
+	{
+	  int64_t x, y;
+
+	  bool operator==(const Cell&) const = default;
+	};
+
+	// both coordinates mixed in full - cells which differ only in the high 32 bits do not collide
+	struct CellHash
+	{
+	  size_t operator()(const Cell& cell) const
+	  {
+		const uint64_t mixed = static_cast<uint64_t>(cell.x) * 0x9E3779B97F4A7C15u ^ static_cast<uint64_t>(cell.y);
+		return std::hash<uint64_t>{}(mixed ^ (mixed >> 32));
+	  }
+	};
+
+	bool is_grid = false;
+	int64_t x_min = 0, y_min = 0;
+	uint64_t width = 0, height = 0;
+	std::vector<uint64_t> grid;
+	std::unordered_set<Cell, CellHash> sparse;
+	size_t obstacles_count = 0;
+
+	uint64_t gridCell(int64_t x, int64_t y) const
+	{
+	  // unsigned wrap-around turns cells left of / below the grid into huge column / row numbers
+	  const auto column = static_cast<uint64_t>(x - x_min);
+	  const auto row = static_cast<uint64_t>(y - y_min);
+
+	  return (column < width && row < height) ? row * width + column : outside_grid;
+	}
+  };
+}
+
+#endif
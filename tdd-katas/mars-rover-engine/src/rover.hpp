@@ -0,0 +1,398 @@
+#ifndef ROVER_HPP
+#define ROVER_HPP
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <optional>
+
+#include "coordinates.hpp"
+#include "obstacle_map.hpp"
+
+// ROVER_TELEMETRY=1 (CMake option ROVER_TELEMETRY) lets Rover record executed commands into TelemetryRing
+#ifndef ROVER_TELEMETRY
+#define ROVER_TELEMETRY 0
+#endif
+
+#if ROVER_TELEMETRY
+#include "telemetry.hpp"
+#endif
+
+namespace TDD
+{
+  class NotSupportedCommandException : std::invalid_argument
+  {
+  public:
+	NotSupportedCommandException() : std::invalid_argument("Not supported command") {}
+  };
+
+  namespace Details
+  {
+	// unit step along x and y axis - indexed by Direction
+	constexpr std::array<double, 4> delta_x{ 0, 1, 0, -1 };
+	constexpr std::array<double, 4> delta_y{ 1, 0, -1, 0 };
+	constexpr std::array<int64_t, 4> cell_delta_x{ 0, 1, 0, -1 };
+	constexpr std::array<int64_t, 4> cell_delta_y{ 1, 0, -1, 0 };
+
+	struct CommandStep
+	{
+	  int8_t move = 0;  // +1 forward, -1 backward
+	  uint8_t turn = 0; // quarter turns clockwise
+	  bool is_supported = false;
+	};
+
+	constexpr std::array<CommandStep, 256> command_steps = [] {
+	  std::array<CommandStep, 256> steps{};
+	  steps['F'] = { .move = 1, .turn = 0, .is_supported = true };
+	  steps['B'] = { .move = -1, .turn = 0, .is_supported = true };
+	  steps['R'] = { .move = 0, .turn = 1, .is_supported = true };
+	  steps['L'] = { .move = 0, .turn = 3, .is_supported = true };
+	  return steps;
+	}();
+
+	// planet limits with NaN (no limit) replaced by infinities, so wrapping needs no NaN checks
+	struct WrapBounds
+	{
+	  double x_min, y_min, x_max, y_max;
+
+	  explicit constexpr WrapBounds(const Limited2dPlane& plane)
+		: x_min(limitOr(plane.x_min, -std::numeric_limits<double>::infinity())),
+		  y_min(limitOr(plane.y_min, -std::numeric_limits<double>::infinity())),
+		  x_max(limitOr(plane.x_max, std::numeric_limits<double>::infinity())),
+		  y_max(limitOr(plane.y_max, std::numeric_limits<double>::infinity()))
+	  {}
+
+	private:
+	  static constexpr double limitOr(double limit, double no_limit)
+	  {
+		return limit != limit ? no_limit : limit;
+	  }
+	};
+
+	// planet limits rounded to grid squares as by ObstacleMap - no limit becomes the int64_t range
+	struct GridBounds
+	{
+	  int64_t x_min, y_min, x_max, y_max;
+
+	  explicit GridBounds(const Limited2dPlane& plane)
+		: x_min(limitOr(plane.x_min, std::numeric_limits<int64_t>::min())),
+		  y_min(limitOr(plane.y_min, std::numeric_limits<int64_t>::min())),
+		  x_max(limitOr(plane.x_max, std::numeric_limits<int64_t>::max())),
+		  y_max(limitOr(plane.y_max, std::numeric_limits<int64_t>::max()))
+	  {}
+
+	private:
+	  static int64_t limitOr(double limit, int64_t no_limit)
+	  {
+		return limit != limit ? no_limit : std::llround(limit);
+	  }
+	};
+
+	// moves value by delta and wraps it to the opposite limit when it leaves [min, max]
+	// - both conditions are evaluated up front, so the selects vectorize and do not branch
+	template <typename T>
+	constexpr T wrap_step(T value, T delta, T min, T max)
+	{
+	  value += delta;
+	  const bool is_over = (delta > 0) & (value > max);
+	  const bool is_under = (delta < 0) & (value < min);
+	  value = is_over ? min : value;
+	  return is_under ? max : value;
+	}
+
+	// moves value by distance in one step - same result as repeated wrap_step calls;
+	// uses modular arithmetic when value lies on the integer grid of a limited axis
+	inline double wrap_distance(double value, double distance, double min, double max)
+	{
+	  if (std::isinf(min) && std::isinf(max))
+		return value + distance;
+
+	  const bool is_on_grid = !std::isinf(min) && !std::isinf(max) && min <= value && value <= max
+		&& std::trunc(min) == min && std::trunc(max) == max && std::trunc(value) == value;
+
+	  if (!is_on_grid)
+	  {
+		const double step = distance > 0 ? 1 : -1;
+		for (double steps_left = std::abs(distance); steps_left > 0; --steps_left)
+		  value = wrap_step(value, step, min, max);
+		return value;
+	  }
+
+	  const double width = max - min + 1;
+	  const double offset = value - min + distance;
+	  return min + (offset - width * std::floor(offset / width));
+	}
+  }
+
+  // command sequence compiled once and run many times - validates commands up front
+  // and folds runs: F x n becomes one move by n, turns L/R x k become one turn by k mod 4
+  class CommandProgram
+  {
+  public:
+	struct Instruction
+	{
+	  int64_t distance = 0; // move forward (> 0) or backward (< 0) by distance
+	  uint8_t turn = 0;     // then turn by quarter turns clockwise
+
+	  bool operator==(const Instruction&) const = default;
+	};
+
+	static constexpr CommandProgram compile(std::string_view sequence)
+	{
+	  CommandProgram program;
+	  program.commands_count = sequence.size();
+
+	  for (char command : sequence)
+	  {
+		const Details::CommandStep& step = Details::command_steps[static_cast<unsigned char>(command)];
+
+		if (!step.is_supported)
+		  throw NotSupportedCommandException();
+
+		if (step.move != 0)
+		{
+		  const bool continues_run = !program.code.empty() && program.code.back().turn == 0
+			&& (program.code.back().distance > 0) == (step.move > 0) && program.code.back().distance != 0;
+
+		  if (continues_run)
+			program.code.back().distance += step.move;
+		  else
+			program.code.push_back({ .distance = step.move, .turn = 0 });
+		}
+		else
+		{
+		  if (program.code.empty())
+			program.code.push_back({});
+
+		  program.code.back().turn = (program.code.back().turn + step.turn) & 3u;
+		}
+	  }
+
+	  return program;
+	}
+
+	constexpr const std::vector<Instruction>& instructions() const
+	{
+	  return code;
+	}
+
+	constexpr size_t commandsCount() const
+	{
+	  return commands_count;
+	}
+
+  private:
+	std::vector<Instruction> code;
+	size_t commands_count = 0;
+  };
+
+  // runtime engine - shared obstacle map and rounding to grid squares are not constexpr in C++20;
+  // GridRover is the engine which runs at compile time
+  class Rover
+  {
+  public:
+	Rover(const Coordinates& initial_coordinates, const Limited2dPlane& planet_limit = {}, std::shared_ptr<const ObstacleMap> obstacles = nullptr)
+	  : current_coordinates(initial_coordinates), wrap_bounds(planet_limit), grid_bounds(planet_limit),
+		obstacles(obstacles ? std::move(obstacles) : noObstacles())
+	{
+	  syncCell();
+	}
+
+	Coordinates getPosition() const
+	{
+	  return current_coordinates;
+	}
+
+	// returns false when an obstacle blocks the move - rover stays in place
+	bool moveForward()
+	{
+	  return runCommand('F');
+	}
+
+	bool moveBackward()
+	{
+	  return runCommand('B');
+	}
+
+	void turnRight()
+	{
+	  runCommand('R');
+	}
+
+	void turnLeft()
+	{
+	  runCommand('L');
+	}
+
+	// runs commands up to the last possible point - returns obstacle which aborted the sequence
+	std::optional<Location> runCommandSequence(std::string_view sequence)
+	{
+	  for (char command : sequence)
+	  {
+		if (auto obstacle = execute(command))
+		  return obstacle;
+	  }
+
+	  return std::nullopt;
+	}
+
+	// executes compiled program - time is proportional to number of runs, not commands
+	// (moves are checked square by square when the planet has obstacles)
+	std::optional<Location> runProgram(const CommandProgram& program)
+	{
+	  for (const CommandProgram::Instruction& instruction : program.instructions())
+	  {
+		if (auto obstacle = moveBy(instruction.distance))
+		  return obstacle;
+
+		// telemetry records half turn as two quarter turns
+		if (isRecording() && instruction.turn == 2)
+		{
+		  execute('R');
+		  execute('R');
+		}
+		else if (isRecording() && instruction.turn != 0)
+		  execute(instruction.turn == 1 ? 'R' : 'L');
+		else
+		  turn(instruction.turn);
+	  }
+
+	  return std::nullopt;
+	}
+
+	// returns false when an obstacle blocks the command
+	bool runCommand(char command)
+	{
+	  return !execute(command);
+	}
+
+#if ROVER_TELEMETRY
+	// records every executed command with the position after it - ring is owned by caller, nullptr stops recording
+	// (compiled programs are then executed square by square and quarter turn by quarter turn)
+	void attachTelemetry(TelemetryRing* ring)
+	{
+	  telemetry = ring;
+	}
+#endif
+
+  private:
+	Coordinates current_coordinates;
+	Details::WrapBounds wrap_bounds;
+	Details::GridBounds grid_bounds;
+	int64_t cell_x = 0, cell_y = 0; // grid square of current_coordinates - obstacles are probed without rounding
+	std::shared_ptr<const ObstacleMap> obstacles;
+#if ROVER_TELEMETRY
+	TelemetryRing* telemetry = nullptr;
+#endif
+
+	static std::shared_ptr<const ObstacleMap> noObstacles()
+	{
+	  static const auto empty_map = std::make_shared<const ObstacleMap>();
+	  return empty_map;
+	}
+
+	// every command moves (by 0 for turns) and turns (by 0 for moves) - no branch on the command
+	std::optional<Location> execute(char command)
+	{
+	  const Details::CommandStep& step = Details::command_steps[static_cast<unsigned char>(command)];
+
+	  if (!step.is_supported)
+		throw NotSupportedCommandException();
+
+	  if (auto obstacle = move(step.move))
+		return obstacle;
+
+	  turn(step.turn);
+	  record(command);
+	  return std::nullopt;
+	}
+
+	// moves by step squares (-1, 0 or 1) unless there is an obstacle - returns the obstacle
+	std::optional<Location> move(int step)
+	{
+	  const auto direction = static_cast<size_t>(current_coordinates.direction);
+	  const Location next{
+		.x = Details::wrap_step(current_coordinates.x, step * Details::delta_x[direction], wrap_bounds.x_min, wrap_bounds.x_max),
+		.y = Details::wrap_step(current_coordinates.y, step * Details::delta_y[direction], wrap_bounds.y_min, wrap_bounds.y_max)
+	  };
+	  const int64_t next_cell_x = Details::wrap_step(cell_x, step * Details::cell_delta_x[direction], grid_bounds.x_min, grid_bounds.x_max);
+	  const int64_t next_cell_y = Details::wrap_step(cell_y, step * Details::cell_delta_y[direction], grid_bounds.y_min, grid_bounds.y_max);
+
+	  // without obstacles the probe is skipped by a branch which is always predicted
+	  if (!obstacles->empty() && step != 0 && obstacles->contains(next_cell_x, next_cell_y))
+		return next;
+
+	  current_coordinates.x = next.x;
+	  current_coordinates.y = next.y;
+	  cell_x = next_cell_x;
+	  cell_y = next_cell_y;
+	  return std::nullopt;
+	}
+
+	std::optional<Location> moveBy(int64_t distance)
+	{
+	  if (!obstacles->empty() || isRecording())
+	  {
+		const char command = distance > 0 ? 'F' : 'B';
+		for (int64_t steps_left = distance > 0 ? distance : -distance; steps_left > 0; --steps_left)
+		{
+		  if (auto obstacle = execute(command))
+			return obstacle;
+		}
+
+		return std::nullopt;
+	  }
+
+	  const auto direction = static_cast<size_t>(current_coordinates.direction);
+	  const auto steps = static_cast<double>(distance);
+
+	  current_coordinates.x = Details::wrap_distance(current_coordinates.x, steps * Details::delta_x[direction], wrap_bounds.x_min, wrap_bounds.x_max);
+	  current_coordinates.y = Details::wrap_distance(current_coordinates.y, steps * Details::delta_y[direction], wrap_bounds.y_min, wrap_bounds.y_max);
+	  syncCell();
+	  return std::nullopt;
+	}
+
+	void turn(unsigned quarter_turns)
+	{
+	  current_coordinates.direction = static_cast<Direction>((static_cast<unsigned>(current_coordinates.direction) + quarter_turns) & 3u);
+	}
+
+	// once per construction or folded run - single moves keep the square up to date
+	void syncCell()
+	{
+	  cell_x = std::llround(current_coordinates.x);
+	  cell_y = std::llround(current_coordinates.y);
+	}
+
+	// both compile to nothing without ROVER_TELEMETRY
+	bool isRecording() const
+	{
+#if ROVER_TELEMETRY
+	  return telemetry != nullptr;
+#else
+	  return false;
+#endif
+	}
+
+	void record([[maybe_unused]] char command)
+	{
+#if ROVER_TELEMETRY
+	  if (telemetry)
+	  {
+		telemetry->push({ .x = static_cast<int32_t>(cell_x),
+						  .y = static_cast<int32_t>(cell_y),
+						  .command = command,
+						  .direction = current_coordinates.direction });
+	  }
+#endif
+	}
+  };
+}
+
+#endif
\ No newline at end of file
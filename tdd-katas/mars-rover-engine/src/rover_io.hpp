@@ -0,0 +1,54 @@
+#ifndef ROVER_IO_HPP
+#define ROVER_IO_HPP
+
+#include <ostream>
+
+#include "coordinates.hpp"
+
+// stream output for rover types - kept out of the engine headers, so the hot code does not pull in iostreams
+namespace TDD
+{
+  inline std::ostream& operator<<(std::ostream& stream, const Direction& direction)
+  {
+	switch (direction)
+	{
+	case Direction::N:
+	  stream << "N";
+	  break;
+	case Direction::E:
+	  stream << "E";
+	  break;
+	case Direction::W:
+	  stream << "W";
+	  break;
+	case Direction::S:
+	  stream << "S";
+	  break;
+	}
+
+	return stream;
+  }
+
+  inline std::ostream& operator<<(std::ostream& stream, const Coordinates& coords)
+  {
+	stream << "{x = " << coords.x << ", y = " << coords.y << ", dir = " << coords.direction;
+
+	return stream;
+  }
+
+  inline std::ostream& operator<<(std::ostream& stream, const Location& location)
+  {
+	stream << "{x = " << location.x << ", y = " << location.y << "}";
+
+	return stream;
+  }
+
+  inline std::ostream& operator<<(std::ostream& stream, const Limited2dPlane& plane)
+  {
+	stream << "{ min(" << plane.x_min << ", " << plane.y_min << "), max(" << plane.x_max << ", " << plane.y_max << ") }";
+
+	return stream;
+  }
+}
+
+#endif
@@ -0,0 +1,116 @@
+#ifndef TELEMETRY_HPP
+#define TELEMETRY_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <memory>
+
+#include "coordinates.hpp"
+
+namespace TDD
+{
+  // one executed command with the rover position after it (rounded to grid squares)
+  struct TelemetryRecord
+  {
+	int32_t x = 0, y = 0;
+	char command = 0;
+	Direction direction = Direction::N;
+
+	bool operator==(const TelemetryRecord&) const = default;
+  };
+
+  static_assert(sizeof(TelemetryRecord) == 12);
+
+  // fixed-size lock-free ring buffer for one producer (rover) and one consumer (drain thread)
+  // - push never blocks or allocates: when the ring is full the record is dropped and counted
+  // - producer and consumer indices live on separate cache lines
+  class TelemetryRing
+  {
+  public:
+	// capacity is rounded up to power of two
+	explicit TelemetryRing(size_t capacity = size_t{ 1 } << 16)
+	  : mask(std::bit_ceil(std::max<size_t>(capacity, 2)) - 1), slots(std::make_unique<TelemetryRecord[]>(mask + 1))
+	{}
+
+	size_t capacity() const
+	{
+	  return mask + 1;
+	}
+
+	// producer side - returns false when the ring is full
+	bool push(const TelemetryRecord& record)
+	{
+	  const size_t head = producer.head.load(std::memory_order_relaxed);
+
+	  if (head - producer.cached_tail == capacity())
+	  {
+		producer.cached_tail = consumer.tail.load(std::memory_order_acquire);
+		if (head - producer.cached_tail == capacity())
+		{
+		  producer.dropped.store(producer.dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+		  return false;
+		}
+	  }
+
+	  slots[head & mask] = record;
+	  producer.head.store(head + 1, std::memory_order_release);
+	  return true;
+	}
+
+	// consumer side - returns false when the ring is empty
+	bool pop(TelemetryRecord& record)
+	{
+	  const size_t tail = consumer.tail.load(std::memory_order_relaxed);
+
+	  if (tail == consumer.cached_head)
+	  {
+		consumer.cached_head = producer.head.load(std::memory_order_acquire);
+		if (tail == consumer.cached_head)
+		  return false;
+	  }
+
+	  record = slots[tail & mask];
+	  consumer.tail.store(tail + 1, std::memory_order_release);
+	  return true;
+	}
+
+	// consumer side - passes all available records to on_record, returns their number
+	template <typename OnRecord>
+	size_t drain(OnRecord&& on_record)
+	{
+	  size_t count = 0;
+	  for (TelemetryRecord record; pop(record); ++count)
+		on_record(record);
+
+	  return count;
+	}
+
+	size_t dropped() const
+	{
+	  return producer.dropped.load(std::memory_order_relaxed);
+	}
+
+  private:
+	struct alignas(64) Producer
+	{
+	  std::atomic<size_t> head{ 0 };
+	  size_t cached_tail = 0;
+	  std::atomic<size_t> dropped{ 0 };
+	};
+
+	struct alignas(64) Consumer
+	{
+	  std::atomic<size_t> tail{ 0 };
+	  size_t cached_head = 0;
+	};
+
+	size_t mask;
+	std::unique_ptr<TelemetryRecord[]> slots;
+	Producer producer;
+	Consumer consumer;
+  };
+}
+
+#endif
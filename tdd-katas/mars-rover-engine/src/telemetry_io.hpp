@@ -0,0 +1,155 @@
+#ifndef TELEMETRY_IO_HPP
+#define TELEMETRY_IO_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <ios>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <vector>
+
+#include "coordinates.hpp"
+#include "telemetry.hpp"
+
+namespace TDD
+{
+  // binary trajectory dump: header followed by records in host byte order
+  // - every field is written on its own and padding is written as zeros, so equal trajectories give equal dumps
+  namespace Telemetry
+  {
+	constexpr std::array<char, 4> MAGIC{ 'R', 'V', 'T', 'L' };
+	constexpr uint32_t VERSION = 1;
+
+	struct Header
+	{
+	  Coordinates start;
+	  Limited2dPlane planet_limit;
+	  uint64_t records_count = 0;
+	};
+
+	// start x, y, direction + 7 zero bytes, planet x_min, y_min, x_max, y_max, records count
+	constexpr size_t HEADER_SIZE = 2 * sizeof(double) + 8 + 4 * sizeof(double) + sizeof(uint64_t);
+	// x, y, command, direction + 2 zero bytes
+	constexpr size_t RECORD_SIZE = 2 * sizeof(int32_t) + 4;
+
+	static_assert(sizeof(Direction) == 1 && HEADER_SIZE == 64 && RECORD_SIZE == 12, "on-disk layout of VERSION 1");
+
+	namespace Details
+	{
+	  template <typename T>
+	  char* put(char* data, const T& value)
+	  {
+		std::memcpy(data, &value, sizeof(value));
+		return data + sizeof(value);
+	  }
+
+	  template <typename T>
+	  const char* get(const char* data, T& value)
+	  {
+		std::memcpy(&value, data, sizeof(value));
+		return data + sizeof(value);
+	  }
+
+	  // bytes left in the stream - SIZE_MAX when the stream cannot seek
+	  inline uint64_t remainingSize(std::istream& stream)
+	  {
+		const std::istream::pos_type position = stream.tellg();
+		if (position == std::istream::pos_type(-1))
+		  return SIZE_MAX;
+
+		stream.seekg(0, std::ios::end);
+		const std::istream::pos_type end = stream.tellg();
+		stream.clear();
+		stream.seekg(position);
+
+		if (end == std::istream::pos_type(-1))
+		  return SIZE_MAX;
+
+		return end > position ? static_cast<uint64_t>(end - position) : 0;
+	  }
+	}
+
+	inline void dump(std::ostream& stream, const Coordinates& start, const Limited2dPlane& planet_limit, const std::vector<TelemetryRecord>& records)
+	{
+	  std::vector<char> data(MAGIC.size() + sizeof(VERSION) + HEADER_SIZE + records.size() * RECORD_SIZE);
+
+	  char* position = std::copy(MAGIC.begin(), MAGIC.end(), data.data());
+	  position = Details::put(position, VERSION);
+
+	  position = Details::put(position, start.x);
+	  position = Details::put(position, start.y);
+	  position = Details::put(position, start.direction) + 7;
+	  position = Details::put(position, planet_limit.x_min);
+	  position = Details::put(position, planet_limit.y_min);
+	  position = Details::put(position, planet_limit.x_max);
+	  position = Details::put(position, planet_limit.y_max);
+	  position = Details::put(position, uint64_t{ records.size() });
+
+	  for (const TelemetryRecord& record : records)
+	  {
+		position = Details::put(position, record.x);
+		position = Details::put(position, record.y);
+		position = Details::put(position, record.command);
+		position = Details::put(position, record.direction) + 2;
+	  }
+
+	  stream.write(data.data(), static_cast<std::streamsize>(data.size()));
+
+	  if (!stream)
+		throw std::runtime_error("cannot write telemetry");
+	}
+
+	// throws runtime_error for truncated or foreign data
+	inline Header load(std::istream& stream, std::vector<TelemetryRecord>& records)
+	{
+	  std::array<char, 4> magic{};
+	  uint32_t version = 0;
+	  std::array<char, HEADER_SIZE> header_data{};
+	  Header header;
+
+	  stream.read(magic.data(), magic.size());
+	  stream.read(reinterpret_cast<char*>(&version), sizeof(version));
+	  stream.read(header_data.data(), header_data.size());
+
+	  if (!stream || magic != MAGIC || version != VERSION)
+		throw std::runtime_error("not a rover telemetry dump");
+
+	  const char* position = header_data.data();
+	  position = Details::get(position, header.start.x);
+	  position = Details::get(position, header.start.y);
+	  position = Details::get(position, header.start.direction) + 7;
+	  position = Details::get(position, header.planet_limit.x_min);
+	  position = Details::get(position, header.planet_limit.y_min);
+	  position = Details::get(position, header.planet_limit.x_max);
+	  position = Details::get(position, header.planet_limit.y_max);
+	  Details::get(position, header.records_count);
+
+	  // records count comes from the file - checked before it sizes any allocation
+	  if (header.records_count > std::min<uint64_t>(SIZE_MAX, Details::remainingSize(stream)) / RECORD_SIZE)
+		throw std::runtime_error("truncated rover telemetry dump");
+
+	  std::vector<char> data(header.records_count * RECORD_SIZE);
+	  stream.read(data.data(), static_cast<std::streamsize>(data.size()));
+
+	  if (!stream)
+		throw std::runtime_error("truncated rover telemetry dump");
+
+	  records.resize(header.records_count);
+	  position = data.data();
+	  for (TelemetryRecord& record : records)
+	  {
+		position = Details::get(position, record.x);
+		position = Details::get(position, record.y);
+		position = Details::get(position, record.command);
+		position = Details::get(position, record.direction) + 2;
+	  }
+
+	  return header;
+	}
+  }
+}
+
+#endif